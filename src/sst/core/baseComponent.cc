@@ -109,9 +109,9 @@ BaseComponent::pushValidParams(Params& params, const std::string& type)
 TimeConverter*
 BaseComponent::registerClock(const std::string& freq, Clock::HandlerBase* handler, bool regAll)
 {
-    TimeConverter* tc = sim_->registerClock(freq, handler, CLOCKPRIORITY);
-
-    // Check to see if there is a profile tool installed
+    // Check to see if there is a profile tool installed.  This has to
+    // happen before the handler is registered, since the clock decides
+    // then whether it can call the handler directly.
     auto tools = sim_->getProfileTool<Profile::ClockHandlerProfileTool>("clock");
 
     for ( auto* tool : tools ) {
@@ -120,6 +120,8 @@ BaseComponent::registerClock(const std::string& freq, Clock::HandlerBase* handle
         handler->addProfileTool(tool, mdata);
     }
 
+    TimeConverter* tc = sim_->registerClock(freq, handler, CLOCKPRIORITY);
+
     // if regAll is true set tc as the default for the component and
     // for all the links
     if ( regAll ) {
@@ -132,9 +134,9 @@ BaseComponent::registerClock(const std::string& freq, Clock::HandlerBase* handle
 TimeConverter*
 BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handler, bool regAll)
 {
-    TimeConverter* tc = sim_->registerClock(freq, handler, CLOCKPRIORITY);
-
-    // Check to see if there is a profile tool installed
+    // Check to see if there is a profile tool installed.  This has to
+    // happen before the handler is registered, since the clock decides
+    // then whether it can call the handler directly.
     auto tools = sim_->getProfileTool<Profile::ClockHandlerProfileTool>("clock");
 
     for ( auto* tool : tools ) {
@@ -143,6 +145,8 @@ BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handle
         handler->addProfileTool(tool, mdata);
     }
 
+    TimeConverter* tc = sim_->registerClock(freq, handler, CLOCKPRIORITY);
+
     // if regAll is true set tc as the default for the component and
     // for all the links
     if ( regAll ) {
@@ -155,9 +159,9 @@ BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handle
 TimeConverter*
 BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll)
 {
-    TimeConverter* tcRet = sim_->registerClock(tc, handler, CLOCKPRIORITY);
-
-    // Check to see if there is a profile tool installed
+    // Check to see if there is a profile tool installed.  This has to
+    // happen before the handler is registered, since the clock decides
+    // then whether it can call the handler directly.
     auto tools = sim_->getProfileTool<Profile::ClockHandlerProfileTool>("clock");
 
     for ( auto* tool : tools ) {
@@ -166,6 +170,8 @@ BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, boo
         handler->addProfileTool(tool, mdata);
     }
 
+    TimeConverter* tcRet = sim_->registerClock(tc, handler, CLOCKPRIORITY);
+
     // if regAll is true set tc as the default for the component and
     // for all the links
     if ( regAll ) {
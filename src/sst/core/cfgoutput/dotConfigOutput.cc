@@ -128,7 +128,7 @@ DotConfigGraphOutput::generateDot(const ConfigLink* link, const uint32_t dot_ver
         fprintf(
             outputFile, "%" PRIu64 ":\"%s\" -- %" PRIu64 ":\"%s\" [label=\"%s\\n%s\"]; \n", link->component[0],
             link->port[0].c_str(), link->component[1], link->port[1].c_str(), link->name.c_str(),
-            link->latency_str[minLatIdx].c_str());
+            link->getLatencyString(minLatIdx).c_str());
 
         // No link name or latency. Connected to specific port on component
     }
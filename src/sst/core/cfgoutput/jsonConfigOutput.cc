@@ -69,7 +69,9 @@ void
 to_json(json::ordered_json& j, SubCompWrapper const& comp_wrapper)
 {
     auto& comp = comp_wrapper.comp;
-    j = json::ordered_json { { "slot_name", comp->name }, { "slot_number", comp->slot_num }, { "type", comp->type } };
+    j          = json::ordered_json {
+        { "slot_name", comp->name }, { "slot_number", comp->slot_num }, { "type", comp->type.str() }
+    };
 
     for ( auto const& paramsItr : comp->getParamsLocalKeys() ) {
         j["params"][paramsItr] = comp->params.find<std::string>(paramsItr);
@@ -92,7 +94,7 @@ void
 to_json(json::ordered_json& j, CompWrapper const& comp_wrapper)
 {
     auto& comp = comp_wrapper.comp;
-    j          = json::ordered_json { { "name", comp->name }, { "type", comp->type } };
+    j          = json::ordered_json { { "name", comp->name }, { "type", comp->type.str() } };
 
     for ( auto const& paramsItr : comp->getParamsLocalKeys() ) {
         j["params"][paramsItr] = comp->params.find<std::string>(paramsItr);
@@ -129,11 +131,11 @@ to_json(json::ordered_json& j, LinkConfPair const& pair)
         j = json::ordered_json { { "name", link->name } };
 
     j["left"]["component"]  = graph->findComponent(link->component[0])->getFullName();
-    j["left"]["port"]       = link->port[0];
-    j["left"]["latency"]    = link->latency_str[0];
+    j["left"]["port"]       = link->port[0].str();
+    j["left"]["latency"]    = link->getLatencyString(0);
     j["right"]["component"] = graph->findComponent(link->component[1])->getFullName();
-    j["right"]["port"]      = link->port[1];
-    j["right"]["latency"]   = link->latency_str[1];
+    j["right"]["port"]      = link->port[1].str();
+    j["right"]["latency"]   = link->getLatencyString(1);
 }
 
 } // namespace
@@ -80,7 +80,7 @@ PythonConfigGraphOutput::generateCommonComponent(const char* objName, const Conf
 
     fprintf(outputFile, "%s.setCoordinates(", objName);
     bool first = true;
-    for ( double d : comp->coords ) {
+    for ( double d : comp->getCoordinates() ) {
         fprintf(outputFile, first ? "%lg" : ", %lg", d);
         first = false;
     }
@@ -110,7 +110,7 @@ PythonConfigGraphOutput::generateCommonComponent(const char* objName, const Conf
         int               idx        = link->component[0] == comp->id ? 0 : 1;
         SimTime_t         latency    = link->latency[idx];
         auto              tmp        = tb * latency;
-        std::string       latencyStr = link->latency_str[idx];
+        std::string       latencyStr = link->getLatencyString(idx);
         char*             esPortName = makeEscapeSafe(link->port[idx].c_str());
 
         const std::string& linkName = getLinkObject(linkID, link->name, link->no_cut);
@@ -21,7 +21,14 @@
 
 namespace SST {
 
-Clock::Clock(TimeConverter* period, int priority) : Action(), currentCycle(0), period(period), scheduled(false)
+Clock::Clock(TimeConverter* period, int priority) :
+    Action(),
+    currentCycle(0),
+    period(period),
+    numHandlers(0),
+    scheduled(false),
+    tickCount(0),
+    handlerCallCount(0)
 {
     setPriority(priority);
 }
@@ -29,8 +36,8 @@ Clock::Clock(TimeConverter* period, int priority) : Action(), currentCycle(0), p
 Clock::~Clock()
 {
     // Delete all the handlers
-    for ( StaticHandlerMap_t::iterator it = staticHandlerMap.begin(); it != staticHandlerMap.end(); ++it ) {
-        delete *it;
+    for ( auto& entry : staticHandlerMap ) {
+        delete entry.handler;
     }
     staticHandlerMap.clear();
 }
@@ -38,7 +45,8 @@ Clock::~Clock()
 bool
 Clock::registerHandler(Clock::HandlerBase* handler)
 {
-    staticHandlerMap.push_back(handler);
+    staticHandlerMap.push_back({ handler, handler->getThunk() });
+    numHandlers++;
     if ( !scheduled ) { schedule(); }
     return 0;
 }
@@ -46,17 +54,17 @@ Clock::registerHandler(Clock::HandlerBase* handler)
 bool
 Clock::unregisterHandler(Clock::HandlerBase* handler, bool& empty)
 {
-
-    StaticHandlerMap_t::iterator iter = staticHandlerMap.begin();
-
-    for ( ; iter != staticHandlerMap.end(); iter++ ) {
-        if ( *iter == handler ) {
-            staticHandlerMap.erase(iter);
+    // Just clear the entry, it will get removed from the vector the
+    // next time the clock fires
+    for ( auto& entry : staticHandlerMap ) {
+        if ( entry.handler == handler ) {
+            entry.handler = nullptr;
+            numHandlers--;
             break;
         }
     }
 
-    empty = staticHandlerMap.empty();
+    empty = (numHandlers == 0);
 
     return 0;
 }
@@ -74,7 +82,8 @@ Clock::execute(void)
 {
     Simulation_impl* sim = Simulation_impl::getSimulation();
 
-    if ( staticHandlerMap.empty() ) {
+    if ( numHandlers == 0 ) {
+        staticHandlerMap.clear();
         scheduled = false;
         return;
     }
@@ -82,23 +91,37 @@ Clock::execute(void)
     // Derive the current cycle from the core time
     // currentCycle = period->convertFromCoreTime(sim->getCurrentSimCycle());
     currentCycle++;
+    tickCount++;
+
+    // Call the handlers, compacting out the ones that are removed as
+    // we go.  Use indices since handlers may register new handlers on
+    // this clock, which can reallocate the vector.
+    size_t num   = staticHandlerMap.size();
+    size_t write = 0;
+    for ( size_t read = 0; read < num; ++read ) {
+        HandlerEntry entry = staticHandlerMap[read];
+        if ( entry.handler == nullptr ) continue;
+
+        bool remove = entry.thunk ? entry.thunk(entry.handler, currentCycle) : (*entry.handler)(currentCycle);
+        handlerCallCount++;
+
+        // The handler may have unregistered itself during the call
+        if ( staticHandlerMap[read].handler == nullptr ) continue;
+
+        if ( remove ) { numHandlers--; }
+        else {
+            staticHandlerMap[write++] = entry;
+        }
+    }
 
-    StaticHandlerMap_t::iterator sop_iter;
-    for ( sop_iter = staticHandlerMap.begin(); sop_iter != staticHandlerMap.end(); ) {
-        Clock::HandlerBase* handler = *sop_iter;
-
-
-        if ( (*handler)(currentCycle) )
-            sop_iter = staticHandlerMap.erase(sop_iter);
-        else
-            ++sop_iter;
-
-        // (*handler)(currentCycle);
-        // ++sop_iter;
+    // Keep anything registered during the loop
+    for ( size_t read = num; read < staticHandlerMap.size(); ++read ) {
+        if ( staticHandlerMap[read].handler != nullptr ) staticHandlerMap[write++] = staticHandlerMap[read];
     }
+    staticHandlerMap.resize(write);
 
     next = sim->getCurrentSimCycle() + period->getFactor();
-    sim->insertActivity(next, this);
+    sim->insertClock(next, this);
 
     return;
 }
@@ -121,7 +144,7 @@ Clock::schedule()
 
     // std::cout << "Scheduling clock " << period->getFactor() << " at cycle " << next << " current cycle is " <<
     // sim->getCurrentSimCycle() << std::endl;
-    sim->insertActivity(next, this);
+    sim->insertClock(next, this);
     scheduled = true;
 }
 
@@ -138,7 +161,78 @@ Clock::toString() const
 {
     std::stringstream buf;
     buf << "Clock Activity with period " << period->getFactor() << " to be delivered at " << getDeliveryTime()
-        << " with priority " << getPriority() << " with " << staticHandlerMap.size() << " items on clock list";
+        << " with priority " << getPriority() << " with " << numHandlers << " items on clock list (" << tickCount
+        << " ticks, " << handlerCallCount << " handler calls)";
+    return buf.str();
+}
+
+ClockBatch::~ClockBatch()
+{
+    // Ticks still in the TimeVortex get deleted with it and take
+    // their clocks with them
+    for ( auto x : free_ticks ) {
+        delete x;
+    }
+}
+
+void
+ClockBatch::insert(SimTime_t time, Clock* clock)
+{
+    clock->setDeliveryTime(time);
+
+    auto  key  = std::make_pair(time, clock->getPriority());
+    auto  iter = pending.find(key);
+    Tick* tick;
+    if ( iter == pending.end() ) {
+        if ( free_ticks.empty() ) { tick = new Tick(this); }
+        else {
+            tick = free_ticks.back();
+            free_ticks.pop_back();
+        }
+        tick->setPriority(clock->getPriority());
+        pending.emplace_hint(iter, key, tick);
+        Simulation_impl::getSimulation()->insertActivity(time, tick);
+    }
+    else {
+        tick = iter->second;
+    }
+    tick->clocks.push_back(clock);
+}
+
+void
+ClockBatch::fire(Tick* tick)
+{
+    // Remove the tick before executing so that anything scheduled
+    // by the clocks gets a new Tick
+    pending.erase(std::make_pair(tick->getDeliveryTime(), tick->getPriority()));
+    firing.swap(tick->clocks);
+    free_ticks.push_back(tick);
+
+    for ( auto clock : firing ) {
+        clock->execute();
+    }
+    firing.clear();
+}
+
+ClockBatch::Tick::~Tick()
+{
+    for ( auto x : clocks ) {
+        delete x;
+    }
+}
+
+void
+ClockBatch::Tick::execute(void)
+{
+    batch->fire(this);
+}
+
+std::string
+ClockBatch::Tick::toString() const
+{
+    std::stringstream buf;
+    buf << "ClockBatch Tick to be delivered at " << getDeliveryTime() << " with priority " << getPriority()
+        << " with " << clocks.size() << " clocks";
     return buf.str();
 }
 
@@ -16,6 +16,7 @@
 #include "sst/core/ssthandler.h"
 
 #include <cinttypes>
+#include <map>
 #include <vector>
 
 #define _CLE_DBG(fmt, args...) __DBG(DBG_CLOCK, Clock, fmt, ##args)
@@ -90,9 +91,29 @@ public:
 
     std::string toString() const override;
 
+    /** Return the number of times this clock has ticked */
+    uint64_t getTickCount() const { return tickCount; }
+
+    /** Return the total number of handler invocations made by this clock */
+    uint64_t getHandlerCallCount() const { return handlerCallCount; }
+
 private:
+    friend class ClockBatch;
+
+    /**
+       Handlers are stored along with their direct call thunk (if they
+       have one) so the common case doesn't go through a virtual call.
+       Unregistered handlers are set to nullptr and removed the next
+       time the clock executes.
+     */
+    struct HandlerEntry
+    {
+        Clock::HandlerBase*          handler;
+        Clock::HandlerBase::Thunk_t thunk;
+    };
+
     /*     typedef std::list<Clock::HandlerBase*> HandlerMap_t; */
-    typedef std::vector<Clock::HandlerBase*> StaticHandlerMap_t;
+    typedef std::vector<HandlerEntry> StaticHandlerMap_t;
 
     Clock() {}
 
@@ -101,13 +122,71 @@ private:
     Cycle_t            currentCycle;
     TimeConverter*     period;
     StaticHandlerMap_t staticHandlerMap;
+    // Number of non-null entries in staticHandlerMap
+    size_t             numHandlers;
     SimTime_t          next;
     bool               scheduled;
 
+    uint64_t tickCount;
+    uint64_t handlerCallCount;
+
     NotSerializable(SST::Clock)
 };
 
 
+/**
+ * Schedules Clocks through a single TimeVortex entry per tick.
+ *
+ * Used when clock batching is enabled.  Instead of each Clock
+ * inserting itself into the TimeVortex, Clocks are held here, grouped
+ * by the (time, priority) at which they next fire.  Only one Tick per
+ * group goes into the TimeVortex, and when it comes up all of the
+ * Clocks in the group are executed in the order they were scheduled,
+ * which is the same order the TimeVortex would have used.
+ */
+class ClockBatch
+{
+public:
+    ClockBatch() {}
+    ~ClockBatch();
+
+    /** Schedule clock to fire at the given time */
+    void insert(SimTime_t time, Clock* clock);
+
+private:
+    /** TimeVortex entry that fires all the Clocks due at one (time, priority) */
+    class Tick : public Action
+    {
+    public:
+        Tick(ClockBatch* batch) : batch(batch) {}
+        ~Tick();
+
+        void execute(void) override;
+
+        std::string toString() const override;
+
+    private:
+        friend class ClockBatch;
+
+        ClockBatch*         batch;
+        std::vector<Clock*> clocks;
+
+        NotSerializable(SST::ClockBatch::Tick)
+    };
+
+    typedef std::map<std::pair<SimTime_t, int>, Tick*> TickMap_t;
+
+    void fire(Tick* tick);
+
+    // Ticks currently in the TimeVortex
+    TickMap_t          pending;
+    // Ticks available for reuse
+    std::vector<Tick*> free_ticks;
+    // Clocks being fired by the current Tick
+    std::vector<Clock*> firing;
+};
+
+
 class ClockHandlerMetaData : public HandlerMetaData
 {
 public:
@@ -96,7 +96,7 @@ ComponentInfo::ComponentInfo(
     enabledAllStats(ccomp->enabledAllStats),
     allStatConfig(&ccomp->allStatConfig),
     statLoadLevel(ccomp->statLoadLevel),
-    coordinates(ccomp->coords),
+    coordinates(ccomp->getCoordinates()),
     subIDIndex(1),
     slot_name(ccomp->name),
     slot_num(ccomp->slot_num),
@@ -158,6 +158,13 @@ public:
         return 0;
     }
 
+    // partition costs
+    static int setPartitionCosts(Config* cfg, const std::string& arg)
+    {
+        cfg->partition_costs_ = arg;
+        return 0;
+    }
+
     // heart beat
     static int setHeartbeat(Config* cfg, const std::string& arg)
     {
@@ -327,6 +334,84 @@ public:
         return success ? 0 : -1;
     }
 
+    // compact graph
+    static int setCompactGraph(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->compact_graph_ = true;
+            return 0;
+        }
+
+        bool success        = false;
+        cfg->compact_graph_ = cfg->parseBoolean(arg, success, "compact-graph");
+        return success ? 0 : -1;
+    }
+
+    // clock batching
+    static int setClockBatching(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->clock_batching_ = true;
+            return 0;
+        }
+
+        bool success         = false;
+        cfg->clock_batching_ = cfg->parseBoolean(arg, success, "clock-batching");
+        return success ? 0 : -1;
+    }
+
+    // asynchronous statistic output
+    static int setAsyncStatOutput(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->async_stat_output_ = true;
+            return 0;
+        }
+
+        bool success            = false;
+        cfg->async_stat_output_ = cfg->parseBoolean(arg, success, "async-stat-output");
+        return success ? 0 : -1;
+    }
+
+    // adaptive rank sync
+    static int setAdaptiveRankSync(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->adaptive_rank_sync_ = true;
+            return 0;
+        }
+
+        bool success             = false;
+        cfg->adaptive_rank_sync_ = cfg->parseBoolean(arg, success, "adaptive-rank-sync");
+        return success ? 0 : -1;
+    }
+
+    // nonblocking rank sync
+    static int setNonblockingRankSync(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->nonblocking_rank_sync_ = true;
+            return 0;
+        }
+
+        bool success                = false;
+        cfg->nonblocking_rank_sync_ = cfg->parseBoolean(arg, success, "nonblocking-rank-sync");
+        return success ? 0 : -1;
+    }
+
+    // shared memory rank sync
+    static int setSharedMemoryRankSync(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->shmem_rank_sync_ = true;
+            return 0;
+        }
+
+        bool success          = false;
+        cfg->shmem_rank_sync_ = cfg->parseBoolean(arg, success, "shmem-rank-sync");
+        return success ? 0 : -1;
+    }
+
 #ifdef USE_MEMPOOL
     // cache align mempool allocations
     static int setCacheAlignMempools(Config* cfg, const std::string& arg)
@@ -341,6 +426,46 @@ public:
     }
 #endif
 
+    // huge pages for mempool arenas and TimeVortex storage
+    static int setHugePages(Config* cfg, const std::string& arg)
+    {
+        std::string arg_lower(arg);
+        std::locale loc;
+        for ( auto& ch : arg_lower )
+            ch = std::tolower(ch, loc);
+
+        if ( arg_lower == "" ) arg_lower = "transparent";
+        if ( arg_lower != "none" && arg_lower != "transparent" && arg_lower != "explicit" ) {
+            fprintf(
+                stderr,
+                "Invalid option '%s' passed to --huge-pages.  Valid options are NONE, TRANSPARENT and EXPLICIT.\n",
+                arg.c_str());
+            return -1;
+        }
+        cfg->huge_pages_ = arg_lower;
+        return 0;
+    }
+
+    // how threads wait at barriers
+    static int setBarrierWaitPolicy(Config* cfg, const std::string& arg)
+    {
+        std::string arg_lower(arg);
+        std::locale loc;
+        for ( auto& ch : arg_lower )
+            ch = std::tolower(ch, loc);
+
+        if ( arg_lower != "spin" && arg_lower != "spin-yield" && arg_lower != "futex" ) {
+            fprintf(
+                stderr,
+                "Invalid option '%s' passed to --barrier-wait-policy.  Valid options are SPIN, SPIN-YIELD and "
+                "FUTEX.\n",
+                arg.c_str());
+            return -1;
+        }
+        cfg->barrier_wait_policy_ = arg_lower;
+        return 0;
+    }
+
     // debug file
     static int setDebugFile(Config* cfg, const std::string& arg)
     {
@@ -362,6 +487,12 @@ public:
         return 0;
     }
 
+    static int setOutputPartitionCosts(Config* cfg, const std::string& arg)
+    {
+        cfg->output_partition_costs_ = arg;
+        return 0;
+    }
+
     static std::string getTimebaseExtHelp()
     {
         std::string msg = "Timebase:\n\n";
@@ -477,6 +608,7 @@ Config::print()
     std::cout << "stop_at = " << stop_at_ << std::endl;
     std::cout << "exit_after = " << exit_after_ << std::endl;
     std::cout << "partitioner = " << partitioner_ << std::endl;
+    std::cout << "partition_costs = " << partition_costs_ << std::endl;
     std::cout << "heartbeatPeriod = " << heartbeatPeriod_ << std::endl;
     std::cout << "output_directory = " << output_directory_ << std::endl;
     std::cout << "output_core_prefix = " << output_core_prefix_ << std::endl;
@@ -489,16 +621,25 @@ Config::print()
     std::cout << "output_partition = " << output_partition_ << std::endl;
     std::cout << "timeBase = " << timeBase_ << std::endl;
     std::cout << "parallel_load = " << parallel_load_ << std::endl;
+    std::cout << "compact_graph = " << compact_graph_ << std::endl;
     std::cout << "timeVortex = " << timeVortex_ << std::endl;
     std::cout << "interthread_links = " << interthread_links_ << std::endl;
+    std::cout << "clock_batching = " << clock_batching_ << std::endl;
+    std::cout << "async_stat_output = " << async_stat_output_ << std::endl;
+    std::cout << "adaptive_rank_sync = " << adaptive_rank_sync_ << std::endl;
+    std::cout << "nonblocking_rank_sync = " << nonblocking_rank_sync_ << std::endl;
+    std::cout << "shmem_rank_sync = " << shmem_rank_sync_ << std::endl;
 #ifdef USE_MEMPOOL
     std::cout << "cache_align_mempools = " << cache_align_mempools_ << std::endl;
 #endif
+    std::cout << "huge_pages = " << huge_pages_ << std::endl;
+    std::cout << "barrier_wait_policy = " << barrier_wait_policy_ << std::endl;
     std::cout << "debugFile = " << debugFile_ << std::endl;
     std::cout << "libpath = " << libpath_ << std::endl;
     std::cout << "addLlibPath = " << addlibpath_ << std::endl;
     std::cout << "enabled_profiling = " << enabled_profiling_ << std::endl;
     std::cout << "profiling_output = " << profiling_output_ << std::endl;
+    std::cout << "output_partition_costs = " << output_partition_costs_ << std::endl;
 
     switch ( runMode_ ) {
     case SimulationRunMode::INIT:
@@ -543,6 +684,7 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     stop_at_         = "0 ns";
     exit_after_      = 0;
     partitioner_     = "sst.linear";
+    partition_costs_ = "";
     heartbeatPeriod_ = "";
 
     char* wd_buf = (char*)malloc(sizeof(char) * PATH_MAX);
@@ -572,16 +714,25 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     timeBase_                 = "1 ps";
     parallel_load_            = false;
     parallel_load_mode_multi_ = true;
+    compact_graph_            = false;
     timeVortex_               = "sst.timevortex.priority_queue";
     interthread_links_        = false;
+    clock_batching_           = false;
+    async_stat_output_        = false;
+    adaptive_rank_sync_       = false;
+    nonblocking_rank_sync_    = false;
+    shmem_rank_sync_          = false;
 #ifdef USE_MEMPOOL
     cache_align_mempools_ = false;
 #endif
-    debugFile_ = "/dev/null";
+    huge_pages_          = "none";
+    barrier_wait_policy_ = "spin-yield";
+    debugFile_           = "/dev/null";
 
     // Advance Options - Profiling
-    enabled_profiling_ = "";
-    profiling_output_  = "stdout";
+    enabled_profiling_      = "";
+    profiling_output_       = "stdout";
+    output_partition_costs_ = "";
 
     // Advanced Options - Debug
     runMode_ = SimulationRunMode::BOTH;
@@ -670,6 +821,11 @@ Config::insertOptions()
     DEF_ARG(
         "partitioner", 0, "PARTITIONER", "Select the partitioner to be used. <lib.partitionerName>",
         std::bind(&ConfigHelper::setPartitioner, this, _1), true);
+    DEF_ARG(
+        "partition-costs", 0, "FILE",
+        "Partition using the component costs and link traffic measured by an earlier run of the same configuration "
+        "(see --output-partition-costs) in place of the component weights and link latencies",
+        std::bind(&ConfigHelper::setPartitionCosts, this, _1), true);
     DEF_ARG(
         "heartbeat-period", 0, "PERIOD",
         "Set time for heartbeats to be published (these are approximate timings, published by the core, to update on "
@@ -729,17 +885,61 @@ Config::insertOptions()
         "formats support both types of file loading.",
         std::bind(&ConfigHelper::enableParallelLoadMode, this, _1), false);
 #endif
+    DEF_FLAG_OPTVAL(
+        "compact-graph", 0,
+        "[EXPERIMENTAL] Set whether data only needed while the configuration graph is being built (link names and "
+        "latency strings) is dropped once the graph is complete, to reduce memory use on very large models",
+        std::bind(&ConfigHelper::setCompactGraph, this, _1), true);
     DEF_ARG(
         "timeVortex", 0, "MODULE", "Select TimeVortex implementation <lib.timevortex>",
         std::bind(&ConfigHelper::setTimeVortex, this, _1), true);
     DEF_FLAG_OPTVAL(
         "interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used",
         std::bind(&ConfigHelper::setInterThreadLinks, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "clock-batching", 0,
+        "[EXPERIMENTAL] Set whether clocks that fire at the same time share a single TimeVortex entry",
+        std::bind(&ConfigHelper::setClockBatching, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "async-stat-output", 0,
+        "[EXPERIMENTAL] Set whether statistic values are copied into a buffer on the simulation thread and formatted "
+        "and written out by a background thread",
+        std::bind(&ConfigHelper::setAsyncStatOutput, this, _1), true);
+#ifdef SST_CONFIG_HAVE_MPI
+    DEF_FLAG_OPTVAL(
+        "adaptive-rank-sync", 0,
+        "[EXPERIMENTAL] Set whether the interval between rank syncs is computed from the latencies of each rank's "
+        "cross-rank links instead of the global minimum partition latency",
+        std::bind(&ConfigHelper::setAdaptiveRankSync, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "nonblocking-rank-sync", 0,
+        "[EXPERIMENTAL] Set whether the rank sync reduction and sends are left in flight while the next window "
+        "executes",
+        std::bind(&ConfigHelper::setNonblockingRankSync, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "shmem-rank-sync", 0,
+        "[EXPERIMENTAL] Set whether ranks on the same node exchange events through shared memory instead of MPI.  "
+        "Only used with one thread per rank when all ranks share a node, and ignores --adaptive-rank-sync and "
+        "--nonblocking-rank-sync",
+        std::bind(&ConfigHelper::setSharedMemoryRankSync, this, _1), true);
+#endif
 #ifdef USE_MEMPOOL
     DEF_FLAG_OPTVAL(
         "cache-align-mempools", 0, "[EXPERIMENTAL] Set whether mempool allocations are cache aligned",
         std::bind(&ConfigHelper::setCacheAlignMempools, this, _1), true);
 #endif
+    DEF_ARG_OPTVAL(
+        "huge-pages", 0, "MODE",
+        "[EXPERIMENTAL] Back mempool arenas and TimeVortex storage with huge pages, first touched by the thread that "
+        "uses them.  MODE is NONE (default), TRANSPARENT (madvise transparent huge pages, used when MODE is omitted) "
+        "or EXPLICIT (reserved huge pages, falling back to TRANSPARENT if none are available)",
+        std::bind(&ConfigHelper::setHugePages, this, _1), true);
+    DEF_ARG(
+        "barrier-wait-policy", 0, "POLICY",
+        "[EXPERIMENTAL] How threads wait at the barriers between simulation threads.  POLICY is SPIN (busy wait, for "
+        "when every thread has its own core), SPIN-YIELD (spin, then yield, then sleep; default) or FUTEX (block in "
+        "the kernel, for when threads are oversubscribed)",
+        std::bind(&ConfigHelper::setBarrierWaitPolicy, this, _1), true);
     DEF_ARG(
         "debug-file", 0, "FILE", "File where debug output will go", std::bind(&ConfigHelper::setDebugFile, this, _1),
         true);
@@ -755,6 +955,11 @@ Config::insertOptions()
     DEF_ARG(
         "profiling-output", 0, "FILE", "Set output location for profiling data [stdout (default) or a filename]",
         std::bind(&ConfigHelper::setProfilingOutput, this, _1), true);
+    DEF_ARG(
+        "output-partition-costs", 0, "FILE",
+        "Measure the time spent in the handlers of each component and the number of events received on each link and "
+        "write them to FILE for use with --partition-costs",
+        std::bind(&ConfigHelper::setOutputPartitionCosts, this, _1), true);
 
     /* Advanced Features - Debug */
     DEF_SECTION_HEADING("Advanced Options - Debug");
@@ -131,6 +131,12 @@ public:
     */
     const std::string& partitioner() const { return partitioner_; }
 
+    /**
+       File of measured component costs and link traffic to partition
+       with
+    */
+    const std::string& partition_costs() const { return partition_costs_; }
+
     /**
        Simulation period at which to print out a "heartbeat" message
     */
@@ -231,11 +237,45 @@ public:
     */
     const std::string& timeVortex() const { return timeVortex_; }
 
+    /**
+       Drop the parts of the ConfigGraph that are only needed while it
+       is being built (link names and latency strings) once the graph
+       is complete
+    */
+    bool compact_graph() const { return compact_graph_; }
+
     /**
        Use links that connect directly to ActivityQueue in receiving thread
     */
     bool interthread_links() const { return interthread_links_; }
 
+    /**
+       Schedule clocks through a single TimeVortex entry per tick
+    */
+    bool clock_batching() const { return clock_batching_; }
+
+    /**
+       Format and write statistic output on a background thread
+    */
+    bool async_stat_output() const { return async_stat_output_; }
+
+    /**
+       Compute the rank sync interval from the latencies of each
+       rank's own cross-rank links rather than the global minimum
+    */
+    bool adaptive_rank_sync() const { return adaptive_rank_sync_; }
+
+    /**
+       Overlap the rank sync reduction and sends with the next window
+    */
+    bool nonblocking_rank_sync() const { return nonblocking_rank_sync_; }
+
+    /**
+       Exchange rank sync data through shared memory when all ranks
+       are on the same node
+    */
+    bool shmem_rank_sync() const { return shmem_rank_sync_; }
+
 #ifdef USE_MEMPOOL
     /**
        Controls whether mempool items are cache-aligned
@@ -243,6 +283,19 @@ public:
     */
     bool cache_align_mempools() const { return cache_align_mempools_; }
 #endif
+
+    /**
+       How mempool arenas and TimeVortex storage are backed by huge
+       pages: none, transparent or explicit
+    */
+    const std::string& huge_pages() const { return huge_pages_; }
+
+    /**
+       How threads wait at the barriers between simulation threads:
+       spin, spin-yield or futex
+    */
+    const std::string& barrier_wait_policy() const { return barrier_wait_policy_; }
+
     /**
        File to which core debug information should be written
     */
@@ -276,6 +329,11 @@ public:
      */
     const std::string& profilingOutput() const { return profiling_output_; }
 
+    /**
+       File to write the measured component costs and link traffic to
+     */
+    const std::string& outputPartitionCosts() const { return output_partition_costs_; }
+
     // Advanced options - Debug
 
     /**
@@ -360,6 +418,7 @@ public:
         ser& stop_at_;
         ser& exit_after_;
         ser& partitioner_;
+        ser& partition_costs_;
         ser& heartbeatPeriod_;
         ser& output_directory_;
         ser& output_core_prefix_;
@@ -376,16 +435,25 @@ public:
         ser& timeBase_;
         ser& parallel_load_;
         ser& parallel_load_mode_multi_;
+        ser& compact_graph_;
         ser& timeVortex_;
         ser& interthread_links_;
+        ser& clock_batching_;
+        ser& async_stat_output_;
+        ser& adaptive_rank_sync_;
+        ser& nonblocking_rank_sync_;
+        ser& shmem_rank_sync_;
 #ifdef USE_MEMPOOL
         ser& cache_align_mempools_;
 #endif
+        ser& huge_pages_;
+        ser& barrier_wait_policy_;
         ser& debugFile_;
         ser& libpath_;
         ser& addlibpath_;
         ser& enabled_profiling_;
         ser& profiling_output_;
+        ser& output_partition_costs_;
         ser& runMode_;
 #ifdef USE_MEMPOOL
         ser& event_dump_file_;
@@ -444,6 +512,7 @@ private:
     std::string stop_at_;            /*!< When to stop the simulation */
     uint32_t    exit_after_;         /*!< When (wall-time) to stop the simulation */
     std::string partitioner_;        /*!< Partitioner to use */
+    std::string partition_costs_;    /*!< Measured costs to partition with */
     std::string heartbeatPeriod_;    /*!< Sets the heartbeat period for the simulation */
     std::string output_directory_;   /*!< Output directory to dump all files to */
     std::string output_core_prefix_; /*!< Set the SST::Output prefix for the core */
@@ -463,18 +532,27 @@ private:
     std::string timeBase_;                 /*!< Timebase of simulation */
     bool        parallel_load_;            /*!< Load simulation graph in parallel */
     bool        parallel_load_mode_multi_; /*!< If true, load using multiple files */
+    bool        compact_graph_;            /*!< Drop graph build-only data once the graph is complete */
     std::string timeVortex_;               /*!< TimeVortex implementation to use */
     bool        interthread_links_;        /*!< Use interthread links */
+    bool        clock_batching_;           /*!< Batch clocks into one TimeVortex entry per tick */
+    bool        async_stat_output_;        /*!< Write statistic output on a background thread */
+    bool        adaptive_rank_sync_;       /*!< Use per-rank lookahead for the rank sync interval */
+    bool        nonblocking_rank_sync_;    /*!< Overlap rank sync communication with execution */
+    bool        shmem_rank_sync_;          /*!< Use shared memory for the rank sync on a single node */
 #ifdef USE_MEMPOOL
     bool cache_align_mempools_; /*!< Cache align allocations from mempools */
 #endif
-    std::string debugFile_; /*!< File to which debug information should be written */
+    std::string huge_pages_;          /*!< Huge page mode for mempool arenas and TimeVortex storage */
+    std::string barrier_wait_policy_; /*!< How threads wait at barriers */
+    std::string debugFile_;           /*!< File to which debug information should be written */
     // std::string libpath_;  ** in ConfigShared
     // std::string addLibPath_; ** in ConfigShared
 
     // Advanced options - profiling
-    std::string enabled_profiling_; /*!< Enabled default profiling points */
-    std::string profiling_output_;  /*!< Location to write profiling data */
+    std::string enabled_profiling_;      /*!< Enabled default profiling points */
+    std::string profiling_output_;       /*!< Location to write profiling data */
+    std::string output_partition_costs_; /*!< File to write measured partition costs to */
 
     // Advanced options - debug
     SimulationRunMode runMode_; /*!< Run Mode (Init, Both, Run-only) */
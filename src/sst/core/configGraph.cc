@@ -19,12 +19,16 @@
 #include "sst/core/from_string.h"
 #include "sst/core/namecheck.h"
 #include "sst/core/simulation_impl.h"
+#include "sst/core/threadsafe.h"
 #include "sst/core/timeLord.h"
 #include "sst/core/warnmacros.h"
 
 #include <algorithm>
+#include <deque>
 #include <fstream>
+#include <sstream>
 #include <string.h>
+#include <unordered_map>
 
 using namespace std;
 
@@ -68,11 +72,42 @@ checkForValidLinkName(const std::string& name)
         bad_link_name_count++;
     }
 }
+
+// Table behind ConfigString.  The strings live in the keys of the map
+// and the deque holds a pointer to each one by index.  Index 0 is the
+// empty string.
+std::unordered_map<std::string, uint32_t> config_string_index({ { "", 0 } });
+std::deque<const std::string*>            config_strings({ &config_string_index.begin()->first });
+SST::Core::ThreadSafe::Spinlock           config_string_lock;
+
 } // anonymous namespace
 
 
 namespace SST {
 
+uint32_t
+ConfigString::intern(const std::string& str)
+{
+    if ( str.empty() ) return 0;
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(config_string_lock);
+    auto ret = config_string_index.emplace(str, config_strings.size());
+    if ( ret.second ) config_strings.push_back(&ret.first->first);
+    return ret.first->second;
+}
+
+const std::string&
+ConfigString::lookup(uint32_t index)
+{
+    return *config_strings[index];
+}
+
+size_t
+ConfigString::tableSize()
+{
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(config_string_lock);
+    return config_strings.size();
+}
+
 void
 ConfigLink::updateLatencies(TimeLord* timeLord)
 {
@@ -99,6 +134,14 @@ ConfigLink::updateLatencies(TimeLord* timeLord)
     // }
 }
 
+std::string
+ConfigLink::getLatencyString(int index) const
+{
+    if ( !latency_str[index].empty() ) return latency_str[index];
+    UnitAlgebra time = Simulation_impl::getTimeLord()->getTimeBase() * latency[index];
+    return time.toStringBestSI();
+}
+
 void
 ConfigStatistic::addParameter(const std::string& key, const std::string& value, bool overwrite)
 {
@@ -328,6 +371,13 @@ ConfigComponent::setCoordinates(const std::vector<double>& c)
         coords.push_back(0.0);
 }
 
+const std::vector<double>&
+ConfigComponent::getCoordinates() const
+{
+    static const std::vector<double> origin(3, 0.0);
+    return coords.empty() ? origin : coords;
+}
+
 void
 ConfigComponent::addParameter(const std::string& key, const std::string& value, bool overwrite)
 {
@@ -692,6 +742,172 @@ ConfigGraph::containsComponentInRank(RankInfo rank)
     return false;
 }
 
+std::vector<ConfigThreadBucket>
+ConfigGraph::bucketByThread(uint32_t rank, uint32_t num_threads)
+{
+    std::vector<ConfigThreadBucket> buckets(num_threads);
+
+    for ( ConfigComponentMap_t::iterator iter = comps.begin(); iter != comps.end(); ++iter ) {
+        if ( (*iter)->rank.rank == rank ) buckets[(*iter)->rank.thread].comps.push_back(*iter);
+    }
+
+    for ( ConfigLinkMap_t::iterator iter = links.begin(); iter != links.end(); ++iter ) {
+        ConfigLink*     clink = *iter;
+        const RankInfo& rank0 = comps[COMPONENT_ID_MASK(clink->component[0])]->rank;
+        const RankInfo& rank1 = comps[COMPONENT_ID_MASK(clink->component[1])]->rank;
+
+        if ( rank0.rank == rank ) buckets[rank0.thread].links.push_back(clink);
+        if ( rank1.rank == rank && rank1 != rank0 ) buckets[rank1.thread].links.push_back(clink);
+    }
+    return buckets;
+}
+
+ConfigThreadLatencies
+ConfigGraph::getThreadLatencies(uint32_t rank, uint32_t num_threads)
+{
+    ConfigThreadLatencies lat;
+    lat.num_threads = num_threads;
+    lat.latency.resize(num_threads * num_threads, MAX_SIMTIME_T);
+    lat.min_latency = MAX_SIMTIME_T;
+    lat.num_links   = 0;
+
+    if ( num_threads == 1 ) return lat;
+
+    for ( ConfigLinkMap_t::iterator iter = links.begin(); iter != links.end(); ++iter ) {
+        ConfigLink*     clink = *iter;
+        const RankInfo& rank0 = comps[COMPONENT_ID_MASK(clink->component[0])]->rank;
+        const RankInfo& rank1 = comps[COMPONENT_ID_MASK(clink->component[1])]->rank;
+
+        // Only links between two threads of this rank matter
+        if ( rank0.rank != rank || rank1.rank != rank || rank0.thread == rank1.thread ) continue;
+
+        lat.num_links++;
+        SimTime_t latency = clink->getMinLatency();
+        if ( latency < lat.min_latency ) lat.min_latency = latency;
+
+        SimTime_t& forward = lat.latency[rank0.thread * num_threads + rank1.thread];
+        SimTime_t& reverse = lat.latency[rank1.thread * num_threads + rank0.thread];
+        if ( latency < forward ) forward = latency;
+        if ( latency < reverse ) reverse = latency;
+    }
+    return lat;
+}
+
+void
+ConfigGraph::applyPartitionCosts(const PartitionCosts& costs)
+{
+    // Component weights are the measured time in microseconds.
+    // Components that spent no measurable time in their handlers
+    // still get a small weight so that they are spread out.
+    uint64_t matched = 0;
+    for ( ConfigComponentMap_t::iterator iter = comps.begin(); iter != comps.end(); ++iter ) {
+        auto cost = costs.component_time.find((*iter)->name);
+        if ( cost != costs.component_time.end() ) matched++;
+        double time_us = cost == costs.component_time.end() ? 0.0 : cost->second / 1000.0;
+        (*iter)->weight = std::max(time_us, 1.0);
+    }
+    if ( matched != costs.component_time.size() ) {
+        output.output(
+            "WARNING: %" PRIu64 " of the %zu components in the partition costs were not found in the "
+            "configuration; the costs may be from a different configuration\n",
+            (uint64_t)(costs.component_time.size() - matched), costs.component_time.size());
+    }
+
+    // Link weights are the number of events received from both ends
+    for ( ConfigLinkMap_t::iterator iter = links.begin(); iter != links.end(); ++iter ) {
+        (*iter)->weight = 0;
+    }
+
+    uint64_t unmatched = 0;
+    for ( auto& x : costs.link_events ) {
+        size_t           index = x.first.rfind(' ');
+        std::string      name  = x.first.substr(0, index);
+        std::string      port  = x.first.substr(index + 1);
+        ConfigComponent* comp  = findComponentByName(name);
+        // Anonymous subcomponents are not in the graph, so fall back
+        // to their component
+        if ( nullptr == comp ) comp = findComponentByName(name.substr(0, name.find(":")));
+
+        // The port may be shared from a parent, so walk up the
+        // hierarchy until the link is found
+        ConfigLink* link = nullptr;
+        while ( nullptr != comp && nullptr == link ) {
+            for ( LinkId_t id : comp->links ) {
+                ConfigLink* clink = links[id];
+                if ( (clink->component[0] == comp->id && clink->port[0] == port) ||
+                     (clink->component[1] == comp->id && clink->port[1] == port) ) {
+                    link = clink;
+                    break;
+                }
+            }
+            comp = comp->getParent();
+        }
+
+        if ( nullptr == link ) {
+            unmatched++;
+            continue;
+        }
+        link->weight += x.second;
+    }
+    if ( unmatched > 0 ) {
+        output.output(
+            "WARNING: %" PRIu64 " of the %zu ports in the partition costs were not found in the "
+            "configuration; the costs may be from a different configuration\n",
+            unmatched, costs.link_events.size());
+    }
+}
+
+void
+PartitionCosts::merge(const PartitionCosts& other)
+{
+    for ( auto& x : other.component_time )
+        component_time[x.first] += x.second;
+    for ( auto& x : other.link_events )
+        link_events[x.first] += x.second;
+}
+
+bool
+PartitionCosts::write(const std::string& file) const
+{
+    FILE* fp = fopen(file.c_str(), "w");
+    if ( nullptr == fp ) return false;
+
+    fprintf(fp, "# SST partition costs\n");
+    fprintf(fp, "# component <name> <handler time (ns)>\n");
+    fprintf(fp, "# link <component> <port> <events received>\n");
+    for ( auto& x : component_time )
+        fprintf(fp, "component %s %" PRIu64 "\n", x.first.c_str(), x.second);
+    for ( auto& x : link_events )
+        fprintf(fp, "link %s %" PRIu64 "\n", x.first.c_str(), x.second);
+
+    return fclose(fp) == 0;
+}
+
+bool
+PartitionCosts::read(const std::string& file)
+{
+    std::ifstream in(file);
+    if ( !in.is_open() ) return false;
+
+    std::string line;
+    while ( std::getline(in, line) ) {
+        if ( line.empty() || line[0] == '#' ) continue;
+
+        std::istringstream fields(line);
+        std::string        kind, name, port;
+        uint64_t           value;
+        fields >> kind >> name;
+        if ( kind == "component" && fields >> value ) { component_time[name] += value; }
+        else if ( kind == "link" && fields >> port >> value ) {
+            link_events[name + " " + port] += value;
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool
 ConfigGraph::checkRanks(RankInfo ranks)
 {
@@ -704,6 +920,16 @@ ConfigGraph::checkRanks(RankInfo ranks)
     return true;
 }
 
+void
+ConfigGraph::compact()
+{
+    std::map<std::string, LinkId_t>().swap(link_names);
+    for ( ConfigLink* link : links ) {
+        link->latency_str[0] = ConfigString();
+        link->latency_str[1] = ConfigString();
+    }
+}
+
 void
 ConfigGraph::postCreationCleanup()
 {
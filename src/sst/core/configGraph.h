@@ -38,9 +38,94 @@ class Config;
 class TimeLord;
 class ConfigGraph;
 
+namespace Core {
+class ConfigGraphReader;
+class ConfigGraphWriter;
+} // namespace Core
+
 typedef SparseVectorMap<ComponentId_t> ComponentIdMap_t;
 typedef std::vector<LinkId_t>          LinkIdMap_t;
 
+/**
+ * A string held in a process-wide table and referred to by its index.
+ * Used for the strings that repeat throughout a ConfigGraph (component
+ * types, port names and latencies), so that each distinct value is
+ * stored once no matter how many links or components use it.
+ *
+ * Strings are added to the table while the graph is built, which
+ * happens on a single thread per rank.  Lookups are not locked.
+ */
+class ConfigString
+{
+public:
+    ConfigString() : index(0) {}
+    ConfigString(const std::string& str) : index(intern(str)) {}
+
+    ConfigString& operator=(const std::string& str)
+    {
+        index = intern(str);
+        return *this;
+    }
+
+    const std::string& str() const { return lookup(index); }
+    const char*        c_str() const { return lookup(index).c_str(); }
+    bool               empty() const { return index == 0; }
+
+    operator const std::string&() const { return lookup(index); }
+
+    bool operator==(const ConfigString& other) const { return index == other.index; }
+    bool operator!=(const ConfigString& other) const { return index != other.index; }
+
+    friend bool operator==(const ConfigString& lhs, const std::string& rhs) { return lhs.str() == rhs; }
+    friend bool operator!=(const ConfigString& lhs, const std::string& rhs) { return lhs.str() != rhs; }
+
+    friend std::ostream& operator<<(std::ostream& os, const ConfigString& s) { return os << s.str(); }
+
+    /** Number of distinct strings in the table, including the empty string */
+    static size_t tableSize();
+
+private:
+    static uint32_t           intern(const std::string& str);
+    static const std::string& lookup(uint32_t index);
+
+    uint32_t index;
+};
+
+} // namespace SST
+
+namespace SST {
+namespace Core {
+namespace Serialization {
+
+/** ConfigStrings are serialized as the string, since the index of a
+ * string differs from process to process */
+template <>
+class serialize<SST::ConfigString>
+{
+public:
+    void operator()(SST::ConfigString& s, SST::Core::Serialization::serializer& ser)
+    {
+        std::string str;
+        switch ( ser.mode() ) {
+        case SST::Core::Serialization::serializer::SIZER:
+        case SST::Core::Serialization::serializer::PACK:
+            str = s.str();
+            ser& str;
+            break;
+        case SST::Core::Serialization::serializer::UNPACK:
+            ser& str;
+            s = str;
+            break;
+        }
+    }
+};
+
+} // namespace Serialization
+} // namespace Core
+} // namespace SST
+
+namespace SST {
+
 /** Represents the configuration of a generic Link */
 class ConfigLink : public SST::Core::Serialization::serializable
 {
@@ -48,13 +133,14 @@ public:
     LinkId_t      id;             /*!< ID of this link */
     std::string   name;           /*!< Name of this link */
     ComponentId_t component[2];   /*!< IDs of the connected components */
-    std::string   port[2];        /*!< Names of the connected ports */
+    ConfigString  port[2];        /*!< Names of the connected ports */
     SimTime_t     latency[2];     /*!< Latency from each side */
-    std::string   latency_str[2]; /*!< Temp string holding latency */
+    ConfigString  latency_str[2]; /*!< Temp string holding latency.  Empty once resolved in a compacted graph */
 
     LinkId_t order;  /*!< Number of components currently referring to this Link.  After graph construction, it will
                        be repurposed to hold the enforce_order value */
     bool     no_cut; /*!< If set to true, partitioner will not make a cut through this Link */
+    float    weight; /*!< Measured traffic on this Link, used by partitioners.  0 if not measured */
 
     // inline const std::string& key() const { return name; }
     inline LinkId_t key() const { return id; }
@@ -66,6 +152,10 @@ public:
         return latency[1];
     }
 
+    /** Return the latency of one side of the link as a string.  Uses
+     * the resolved latency if the string has been dropped */
+    std::string getLatencyString(int index) const;
+
     /** Print the Link information */
     void print(std::ostream& os) const
     {
@@ -100,7 +190,8 @@ public:
 
 private:
     friend class ConfigGraph;
-    ConfigLink(LinkId_t id) : id(id), no_cut(false)
+    friend class Core::ConfigGraphReader;
+    ConfigLink(LinkId_t id) : id(id), no_cut(false), weight(0)
     {
         order = 0;
 
@@ -109,7 +200,7 @@ private:
         component[1] = ULONG_MAX;
     }
 
-    ConfigLink(LinkId_t id, const std::string& n) : id(id), no_cut(false)
+    ConfigLink(LinkId_t id, const std::string& n) : id(id), no_cut(false), weight(0)
     {
         order = 0;
         name  = n;
@@ -223,7 +314,7 @@ public:
     ConfigGraph*          graph;         /*!< Graph that this component belongs to */
     std::string           name;          /*!< Name of this component, or slot name for subcomp */
     int                   slot_num;      /*!< Slot number.  Only valid for subcomponents */
-    std::string           type;          /*!< Type of this component */
+    ConfigString          type;          /*!< Type of this component */
     float                 weight;        /*!< Partitioning weight for this component */
     RankInfo              rank;          /*!< Parallel Rank for this component */
     std::vector<LinkId_t> links;         /*!< List of links connected */
@@ -236,7 +327,7 @@ public:
     ConfigStatistic                      allStatConfig;
 
     std::vector<ConfigComponent*> subComponents; /*!< List of subcomponents */
-    std::vector<double>           coords;
+    std::vector<double>           coords;        /*!< Coordinates, empty if they were never set */
     uint16_t nextSubID;  /*!< Next subID to use for children, if component, if subcomponent, subid of parent */
     uint16_t nextStatID; /*!< Next statID to use for children */
     bool     visited;    /*! Used when traversing graph to indicate component was visited already */
@@ -266,6 +357,9 @@ public:
     ConfigComponent* getParent() const;
     std::string      getFullName() const;
 
+    /** Return the coordinates, which are (0,0,0) if they were never set */
+    const std::vector<double>& getCoordinates() const;
+
     void                   setRank(RankInfo r);
     void                   setWeight(double w);
     void                   setCoordinates(const std::vector<double>& c);
@@ -328,6 +422,8 @@ private:
     ComponentId_t getNextSubComponentID();
 
     friend class ConfigGraph;
+    friend class Core::ConfigGraphReader;
+    friend class Core::ConfigGraphWriter;
     /** Checks to make sure port names are valid and that a port isn't used twice
      */
     void checkPorts() const;
@@ -346,9 +442,7 @@ private:
         enabledAllStats(false),
         nextSubID(1),
         nextStatID(1)
-    {
-        coords.resize(3, 0.0);
-    }
+    {}
 
     ConfigComponent(
         ComponentId_t id, ConfigGraph* graph, uint16_t parent_subid, const std::string& name, int slot_num,
@@ -364,9 +458,7 @@ private:
         enabledAllStats(false),
         nextSubID(parent_subid),
         nextStatID(parent_subid)
-    {
-        coords.resize(3, 0.0);
-    }
+    {}
 };
 
 /** Map names to Links */
@@ -383,6 +475,63 @@ typedef std::map<std::string, std::string>               VariableMap_t;
 
 class PartitionGraph;
 
+/**
+ * The components and links of a ConfigGraph that one thread builds.
+ * Links between two threads of the same rank are in both threads'
+ * buckets.
+ */
+struct ConfigThreadBucket
+{
+    std::vector<ConfigComponent*> comps;
+    std::vector<ConfigLink*>      links;
+};
+
+/**
+ * Minimum latency of the links between each pair of threads on a
+ * rank.  Computed once from the graph and then shared read-only by
+ * all the threads.
+ */
+struct ConfigThreadLatencies
+{
+    uint32_t               num_threads;
+    std::vector<SimTime_t> latency;     // num_threads x num_threads, MAX_SIMTIME_T if not linked
+    SimTime_t              min_latency; // Smallest latency between any two threads
+    uint64_t               num_links;   // Number of links between threads
+
+    SimTime_t get(uint32_t from, uint32_t to) const { return latency[from * num_threads + to]; }
+};
+
+/**
+ * Time spent in each component and number of events received on each
+ * link, measured during a run so that a later run of the same
+ * configuration can partition by measured load.  Components are
+ * identified by name and links by the full name of the receiving
+ * (sub)component and port, so the costs still match if ids change.
+ */
+class PartitionCosts : public SST::Core::Serialization::serializable
+{
+public:
+    /** Time spent in the handlers of each component, in nanoseconds */
+    std::map<std::string, uint64_t> component_time;
+    /** Number of events received on each port, keyed by "component port" */
+    std::map<std::string, uint64_t> link_events;
+
+    /** Add in the costs measured on another thread or rank */
+    void merge(const PartitionCosts& other);
+    /** Write the costs to file.  Returns false if the file could not be written */
+    bool write(const std::string& file) const;
+    /** Read costs written by write().  Returns false if the file could not be read */
+    bool read(const std::string& file);
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& component_time;
+        ser& link_events;
+    }
+
+    ImplementSerializable(SST::PartitionCosts)
+};
+
 /** A Configuration Graph
  *  A graph representing Components and Links
  */
@@ -420,6 +569,16 @@ public:
     bool containsComponentInRank(RankInfo rank);
     /** Verify that all components have valid Ranks assigned */
     bool checkRanks(RankInfo ranks);
+    /** Sort the components and links on an MPI rank into one bucket
+     * per thread, so each thread can build its part of the graph
+     * without looking at the rest of it */
+    std::vector<ConfigThreadBucket> bucketByThread(uint32_t rank, uint32_t num_threads);
+    /** Find the minimum latency between each pair of threads on an
+     * MPI rank */
+    ConfigThreadLatencies           getThreadLatencies(uint32_t rank, uint32_t num_threads);
+    /** Replace the component weights with the measured component
+     * costs and set the link weights to the measured traffic */
+    void                            applyPartitionCosts(const PartitionCosts& costs);
 
     // API for programmatic initialization
     /** Create a new component */
@@ -460,6 +619,11 @@ public:
     /** Check the graph for Structural errors */
     bool checkForStructuralErrors();
 
+    /** Drop the data that is only needed while the graph is being
+     * built: the link name lookup table and the latency strings, which
+     * have been resolved by postCreationCleanup() */
+    void compact();
+
     // Temporary until we have a better API
     /** Return the map of components */
     ConfigComponentMap_t& getComponentMap() { return comps; }
@@ -514,6 +678,8 @@ public:
 private:
     friend class Simulation_impl;
     friend class SSTSDLModelDefinition;
+    friend class Core::ConfigGraphReader;
+    friend class Core::ConfigGraphWriter;
 
     Output output;
 
@@ -581,6 +747,7 @@ public:
     ComponentId_t component[2];
     SimTime_t     latency[2];
     bool          no_cut;
+    float         weight;
 
     PartitionLink(const ConfigLink& cl)
     {
@@ -590,6 +757,7 @@ public:
         latency[0]   = cl.latency[0];
         latency[1]   = cl.latency[1];
         no_cut       = cl.no_cut;
+        weight       = cl.weight;
     }
 
     inline LinkId_t key() const { return id; }
@@ -0,0 +1,512 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/configGraphCodec.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/objectSerialization.h"
+#include "sst/core/params.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace SST {
+namespace Core {
+
+namespace {
+
+// Record types
+enum : uint8_t { RECORD_END = 0, RECORD_GRAPH = 1, RECORD_COMPONENT = 2, RECORD_LINK = 3 };
+
+// Size at which sendConfigGraph() sends a chunk
+const size_t send_chunk_size = 1024 * 1024;
+
+} // namespace
+
+ConfigGraphWriter::ConfigGraphWriter(size_t chunk_size, ChunkHandler handler) :
+    chunk_size(chunk_size),
+    handler(handler),
+    prev_link_id(0),
+    prev_comp_id(0)
+{
+    buffer.reserve(chunk_size + chunk_size / 4);
+}
+
+void
+ConfigGraphWriter::write(ConfigGraph& graph)
+{
+    // Graph wide settings.  The statistic outputs and groups are few
+    // and small, so they go through the generic serializer.
+    putByte(RECORD_GRAPH);
+    putByte(graph.statLoadLevel);
+    std::vector<char> blob = Comms::serialize(graph.statOutputs);
+    putVarint(blob.size());
+    putBytes(blob.data(), blob.size());
+    blob = Comms::serialize(graph.statGroups);
+    putVarint(blob.size());
+    putBytes(blob.data(), blob.size());
+    endRecord();
+
+    for ( ConfigComponentMap_t::iterator it = graph.comps.begin(); it != graph.comps.end(); ++it ) {
+        putByte(RECORD_COMPONENT);
+        putComponent(*it);
+        endRecord();
+    }
+
+    for ( ConfigLinkMap_t::iterator it = graph.links.begin(); it != graph.links.end(); ++it ) {
+        putByte(RECORD_LINK);
+        putLink(*it);
+        endRecord();
+    }
+
+    putByte(RECORD_END);
+    handler(buffer);
+    buffer.clear();
+}
+
+void
+ConfigGraphWriter::endRecord()
+{
+    if ( buffer.size() < chunk_size ) return;
+    handler(buffer);
+    buffer.clear();
+}
+
+void
+ConfigGraphWriter::putVarint(uint64_t value)
+{
+    while ( value >= 0x80 ) {
+        buffer.push_back((char)(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((char)value);
+}
+
+void
+ConfigGraphWriter::putSigned(int64_t value)
+{
+    // Zigzag encode so small negative values stay small
+    putVarint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+template <typename T>
+void
+ConfigGraphWriter::putRaw(const T& value)
+{
+    putBytes(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void
+ConfigGraphWriter::putBytes(const char* data, size_t size)
+{
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+void
+ConfigGraphWriter::putString(const std::string& str)
+{
+    // Index + 1 of a string already sent, or 0 followed by a new
+    // string, which gets the next index
+    auto it = strings.find(str);
+    if ( it != strings.end() ) {
+        putVarint(it->second + 1);
+        return;
+    }
+    uint64_t index = strings.size();
+    strings.emplace(str, index);
+    putVarint(0);
+    putVarint(str.size());
+    putBytes(str.data(), str.size());
+}
+
+void
+ConfigGraphWriter::putName(const std::string& name, std::string& prev)
+{
+    size_t shared = 0;
+    size_t max    = std::min(name.size(), prev.size());
+    while ( shared < max && name[shared] == prev[shared] )
+        shared++;
+    putVarint(shared);
+    putVarint(name.size() - shared);
+    putBytes(name.data() + shared, name.size() - shared);
+    prev = name;
+}
+
+void
+ConfigGraphWriter::putParams(Params& params)
+{
+    putVarint(params.my_data.size());
+    for ( auto& x : params.my_data ) {
+        putVarint(x.first);
+        putString(x.second);
+    }
+    // Global param sets are sent by name.  Slot 0 of a global set
+    // holds its name.
+    putVarint(params.data.size() - 1);
+    for ( size_t i = 1; i < params.data.size(); ++i ) {
+        putString((*params.data[i])[0]);
+    }
+}
+
+void
+ConfigGraphWriter::putStatistic(ConfigStatistic& stat)
+{
+    putVarint(stat.id);
+    putByte(stat.shared);
+    putString(stat.name);
+    putParams(stat.params);
+}
+
+void
+ConfigGraphWriter::putComponent(ConfigComponent* comp)
+{
+    if ( comp->id == COMPONENT_ID_MASK(comp->id) ) {
+        // Components are sent in id order and have unique names
+        putVarint(comp->id - prev_comp_id);
+        prev_comp_id = comp->id;
+        putName(comp->name, prev_comp_name);
+    }
+    else {
+        // Subcomponent names are slot names, which repeat
+        putVarint(comp->id);
+        putString(comp->name);
+    }
+    putSigned(comp->slot_num);
+    putString(comp->type);
+    putRaw(comp->weight);
+    putVarint(comp->rank.rank);
+    putVarint(comp->rank.thread);
+
+    putVarint(comp->links.size());
+    LinkId_t prev_id = 0;
+    for ( LinkId_t id : comp->links ) {
+        putSigned((int64_t)(id - prev_id));
+        prev_id = id;
+    }
+
+    putParams(comp->params);
+
+    putVarint(comp->enabledStatNames.size());
+    for ( auto& x : comp->enabledStatNames ) {
+        putString(x.first);
+        putVarint(x.second);
+    }
+    putByte(comp->enabledAllStats);
+    putVarint(comp->statistics.size());
+    for ( auto& x : comp->statistics ) {
+        putStatistic(x.second);
+    }
+    putStatistic(comp->allStatConfig);
+    putByte(comp->statLoadLevel);
+
+    putVarint(comp->subComponents.size());
+    for ( ConfigComponent* sub : comp->subComponents ) {
+        putComponent(sub);
+    }
+
+    putVarint(comp->coords.size());
+    for ( double coord : comp->coords ) {
+        putRaw(coord);
+    }
+    putVarint(comp->nextSubID);
+    putVarint(comp->nextStatID);
+}
+
+void
+ConfigGraphWriter::putLink(ConfigLink* link)
+{
+    // Links are sent in id order and have unique names
+    putVarint(link->id - prev_link_id);
+    prev_link_id = link->id;
+    putName(link->name, prev_link_name);
+    for ( int i = 0; i < 2; ++i ) {
+        putVarint(link->component[i]);
+        putString(link->port[i]);
+        putVarint(link->latency[i]);
+        putString(link->latency_str[i]);
+    }
+    putVarint(link->order);
+}
+
+
+ConfigGraphReader::ConfigGraphReader(ConfigGraph& graph) :
+    graph(graph),
+    pos(nullptr),
+    end(nullptr),
+    done(false),
+    prev_link_id(0),
+    prev_comp_id(0)
+{}
+
+bool
+ConfigGraphReader::read(const char* data, size_t size)
+{
+    pos = data;
+    end = data + size;
+    while ( pos < end ) {
+        if ( done ) throw std::runtime_error("ConfigGraphReader: data found after the end of the graph");
+
+        switch ( getByte() ) {
+        case RECORD_GRAPH:
+        {
+            graph.statLoadLevel = getByte();
+
+            std::vector<ConfigStatOutput> outputs;
+            size_t                        blob_size = getVarint();
+            need(blob_size);
+            Comms::deserialize(const_cast<char*>(pos), blob_size, outputs);
+            graph.statOutputs.swap(outputs);
+            pos += blob_size;
+
+            std::map<std::string, ConfigStatGroup> groups;
+            blob_size = getVarint();
+            need(blob_size);
+            Comms::deserialize(const_cast<char*>(pos), blob_size, groups);
+            graph.statGroups.swap(groups);
+            pos += blob_size;
+            break;
+        }
+        case RECORD_COMPONENT:
+            graph.comps.insert(getComponent(true));
+            break;
+        case RECORD_LINK:
+            getLink();
+            break;
+        case RECORD_END:
+            graph.setComponentConfigGraphPointers();
+            done = true;
+            break;
+        default:
+            throw std::runtime_error("ConfigGraphReader: unknown record type");
+        }
+    }
+    return done;
+}
+
+void
+ConfigGraphReader::need(size_t size)
+{
+    if ( (size_t)(end - pos) < size ) throw std::runtime_error("ConfigGraphReader: record is truncated");
+}
+
+uint8_t
+ConfigGraphReader::getByte()
+{
+    need(1);
+    return (uint8_t)*pos++;
+}
+
+uint64_t
+ConfigGraphReader::getVarint()
+{
+    uint64_t value = 0;
+    for ( int shift = 0; shift < 64; shift += 7 ) {
+        uint8_t byte = getByte();
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if ( !(byte & 0x80) ) return value;
+    }
+    throw std::runtime_error("ConfigGraphReader: invalid varint");
+}
+
+int64_t
+ConfigGraphReader::getSigned()
+{
+    uint64_t value = getVarint();
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+template <typename T>
+T
+ConfigGraphReader::getRaw()
+{
+    T value;
+    need(sizeof(T));
+    memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+const std::string&
+ConfigGraphReader::getString()
+{
+    uint64_t index = getVarint();
+    if ( index > 0 ) {
+        if ( index > strings.size() ) throw std::runtime_error("ConfigGraphReader: unknown string");
+        return strings[index - 1];
+    }
+    size_t size = getVarint();
+    need(size);
+    strings.emplace_back(pos, size);
+    pos += size;
+    return strings.back();
+}
+
+const std::string&
+ConfigGraphReader::getName(std::string& prev)
+{
+    size_t shared = getVarint();
+    size_t size   = getVarint();
+    if ( shared > prev.size() ) throw std::runtime_error("ConfigGraphReader: invalid name");
+    need(size);
+    prev.resize(shared);
+    prev.append(pos, size);
+    pos += size;
+    return prev;
+}
+
+void
+ConfigGraphReader::getParams(Params& params)
+{
+    uint64_t count = getVarint();
+    for ( uint64_t i = 0; i < count; ++i ) {
+        uint32_t key = getVarint();
+        params.my_data.emplace_hint(params.my_data.end(), key, getString());
+    }
+    count = getVarint();
+    for ( uint64_t i = 0; i < count; ++i ) {
+        params.addGlobalParamSet(getString());
+    }
+}
+
+void
+ConfigGraphReader::getStatistic(ConfigStatistic& stat)
+{
+    stat.id     = getVarint();
+    stat.shared = getByte();
+    stat.name   = getString();
+    getParams(stat.params);
+}
+
+ConfigComponent*
+ConfigGraphReader::getComponent(bool top)
+{
+    ConfigComponent* comp = new ConfigComponent();
+    if ( top ) {
+        comp->id     = prev_comp_id + getVarint();
+        prev_comp_id = comp->id;
+        comp->name   = getName(prev_comp_name);
+    }
+    else {
+        comp->id   = getVarint();
+        comp->name = getString();
+    }
+    comp->slot_num    = getSigned();
+    comp->type        = getString();
+    comp->weight      = getRaw<float>();
+    comp->rank.rank   = getVarint();
+    comp->rank.thread = getVarint();
+
+    comp->links.resize(getVarint());
+    LinkId_t prev_id = 0;
+    for ( LinkId_t& id : comp->links ) {
+        id      = prev_id + getSigned();
+        prev_id = id;
+    }
+
+    getParams(comp->params);
+
+    uint64_t count = getVarint();
+    for ( uint64_t i = 0; i < count; ++i ) {
+        std::string name             = getString();
+        comp->enabledStatNames[name] = getVarint();
+    }
+    comp->enabledAllStats = getByte();
+    count                 = getVarint();
+    for ( uint64_t i = 0; i < count; ++i ) {
+        ConfigStatistic stat;
+        getStatistic(stat);
+        comp->statistics.emplace_hint(comp->statistics.end(), stat.id, stat);
+    }
+    getStatistic(comp->allStatConfig);
+    comp->statLoadLevel = getByte();
+
+    comp->subComponents.resize(getVarint());
+    for ( ConfigComponent*& sub : comp->subComponents ) {
+        sub = getComponent(false);
+    }
+
+    comp->coords.resize(getVarint());
+    for ( double& coord : comp->coords ) {
+        coord = getRaw<double>();
+    }
+    comp->nextSubID  = getVarint();
+    comp->nextStatID = getVarint();
+    return comp;
+}
+
+void
+ConfigGraphReader::getLink()
+{
+    ConfigLink* link = new ConfigLink(prev_link_id + getVarint());
+    prev_link_id     = link->id;
+    link->name       = getName(prev_link_name);
+    for ( int i = 0; i < 2; ++i ) {
+        link->component[i]   = getVarint();
+        link->port[i]        = getString();
+        link->latency[i]     = getVarint();
+        link->latency_str[i] = getString();
+    }
+    link->order = getVarint();
+    graph.links.insert(link);
+}
+
+
+#ifdef SST_CONFIG_HAVE_MPI
+void
+sendConfigGraph(int dest, int tag, ConfigGraph& graph)
+{
+    // Send each chunk while the next one is encoded.  The previous
+    // send has to finish before its buffer is reused.
+    std::vector<char> in_flight;
+    MPI_Request       request = MPI_REQUEST_NULL;
+
+    ConfigGraphWriter writer(send_chunk_size, [&](std::vector<char>& chunk) {
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+        in_flight.swap(chunk);
+        MPI_Isend(in_flight.data(), in_flight.size(), MPI_BYTE, dest, tag, MPI_COMM_WORLD, &request);
+    });
+    writer.write(graph);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+int
+recvConfigGraph(int src, int tag, ConfigGraph& graph)
+{
+    ConfigGraphReader reader(graph);
+    std::vector<char> buffer;
+    bool              done = false;
+    while ( !done ) {
+        MPI_Status status;
+        MPI_Probe(src, tag, MPI_COMM_WORLD, &status);
+        // The rest of the chunks come from the same rank
+        src = status.MPI_SOURCE;
+
+        int size = 0;
+        MPI_Get_count(&status, MPI_BYTE, &size);
+        buffer.resize(size);
+        MPI_Recv(buffer.data(), size, MPI_BYTE, src, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        done = reader.read(buffer.data(), size);
+    }
+    return src;
+}
+#endif
+
+} // namespace Core
+} // namespace SST
@@ -0,0 +1,160 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CONFIGGRAPHCODEC_H
+#define SST_CORE_CONFIGGRAPHCODEC_H
+
+#include "sst/core/sst_types.h"
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+
+class ConfigComponent;
+class ConfigGraph;
+class ConfigLink;
+class ConfigStatistic;
+class Params;
+
+namespace Core {
+
+/**
+ * Writes a ConfigGraph in a compact binary format used to send the
+ * graph from rank to rank.
+ *
+ * The generic serializer writes every string in full and every
+ * integer at its full width.  This format instead:
+ *  - writes integers as varints, and sorted ids as the difference
+ *    from the previous id
+ *  - interns strings that repeat (types, port and slot names,
+ *    latencies, parameter values): the first use writes the string
+ *    and later uses write its index
+ *  - writes link and component names, which are unique but tend to
+ *    share prefixes, as the length of the prefix shared with the
+ *    previous name followed by the rest of the name
+ *
+ * The graph is written as a sequence of records (one per link or
+ * component), and the encoded data is handed out in chunks that end
+ * on record boundaries, so each chunk can be decoded as soon as it
+ * arrives.
+ */
+class ConfigGraphWriter
+{
+public:
+    /** Called with each chunk of encoded data.  The handler may take
+     * the contents of the vector; the writer clears it after the
+     * call */
+    using ChunkHandler = std::function<void(std::vector<char>& chunk)>;
+
+    /**
+     * @param chunk_size Size at which a chunk is handed out
+     * @param handler Function called with each chunk
+     */
+    ConfigGraphWriter(size_t chunk_size, ChunkHandler handler);
+
+    /** Encode graph, handing out the chunks as they fill */
+    void write(ConfigGraph& graph);
+
+private:
+    void endRecord();
+
+    void putByte(uint8_t value) { buffer.push_back((char)value); }
+    void putVarint(uint64_t value);
+    void putSigned(int64_t value);
+    template <typename T>
+    void putRaw(const T& value);
+    void putBytes(const char* data, size_t size);
+    void putString(const std::string& str);
+    void putName(const std::string& name, std::string& prev);
+
+    void putParams(Params& params);
+    void putStatistic(ConfigStatistic& stat);
+    void putComponent(ConfigComponent* comp);
+    void putLink(ConfigLink* link);
+
+    size_t            chunk_size;
+    ChunkHandler      handler;
+    std::vector<char> buffer;
+
+    std::unordered_map<std::string, uint64_t> strings;
+
+    std::string   prev_link_name;
+    std::string   prev_comp_name;
+    LinkId_t      prev_link_id;
+    ComponentId_t prev_comp_id;
+};
+
+/**
+ * Decodes the chunks written by a ConfigGraphWriter directly into a
+ * ConfigGraph.  Chunks must be passed in the order they were written.
+ */
+class ConfigGraphReader
+{
+public:
+    /** Decode into graph, which should be empty */
+    ConfigGraphReader(ConfigGraph& graph);
+
+    /**
+     * Decode one chunk
+     * @return true once the end of the graph has been decoded
+     */
+    bool read(const char* data, size_t size);
+
+private:
+    void     need(size_t size);
+    uint8_t  getByte();
+    uint64_t getVarint();
+    int64_t  getSigned();
+    template <typename T>
+    T                  getRaw();
+    const std::string& getString();
+    const std::string& getName(std::string& prev);
+
+    void             getParams(Params& params);
+    void             getStatistic(ConfigStatistic& stat);
+    ConfigComponent* getComponent(bool top);
+    void             getLink();
+
+    ConfigGraph& graph;
+    const char*  pos;
+    const char*  end;
+    bool         done;
+
+    std::vector<std::string> strings;
+
+    std::string   prev_link_name;
+    std::string   prev_comp_name;
+    LinkId_t      prev_link_id;
+    ComponentId_t prev_comp_id;
+};
+
+#ifdef SST_CONFIG_HAVE_MPI
+/**
+ * Send graph to rank dest in the ConfigGraphWriter format.  Each chunk
+ * is sent while the next one is being encoded.
+ */
+void sendConfigGraph(int dest, int tag, ConfigGraph& graph);
+
+/**
+ * Receive a graph sent with sendConfigGraph(), decoding each chunk as
+ * it arrives.
+ * @return the rank the graph came from
+ */
+int recvConfigGraph(int src, int tag, ConfigGraph& graph);
+#endif
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_CONFIGGRAPHCODEC_H
@@ -19,11 +19,13 @@
 #include <atomic>
 #include <cinttypes>
 #include <string>
+#include <vector>
 
 namespace SST {
 
 class Link;
 class NullEvent;
+class EventBatch;
 class RankSync;
 class ThreadSync;
 
@@ -60,6 +62,29 @@ public:
     template <typename classT, typename dataT = void>
     using Handler = SSTHandler<void, Event*, classT, dataT>;
 
+    /**
+       Base handler for batched event delivery.
+     */
+    using BatchHandlerBase = SSTHandlerBase<void, std::vector<Event*>&>;
+
+    /**
+       Used to create handlers for batched event delivery (see
+       Link::sendBatch()).  The callback function is expected to be in
+       the form of:
+
+         void func(std::vector<Event*>& events)
+
+       In which case, the class is created with:
+
+         new Event::BatchHandler<classname>(this, &classname::function_name)
+
+       The handler takes ownership of the events in the vector, but
+       not the vector itself.  Static data can be added the same way
+       as for Event::Handler.
+     */
+    template <typename classT, typename dataT = void>
+    using BatchHandler = SSTHandler<void, std::vector<Event*>&, classT, dataT>;
+
     /** Type definition of unique identifiers */
     typedef std::pair<uint64_t, int> id_type;
     /** Constant, default value for id_types */
@@ -137,6 +162,7 @@ protected:
 private:
     friend class Link;
     friend class NullEvent;
+    friend class EventBatch;
     friend class RankSync;
     friend class ThreadSync;
 
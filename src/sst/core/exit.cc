@@ -154,6 +154,13 @@ Exit::computeEndTime()
     return end_time;
 }
 
+void
+Exit::setGlobalState(unsigned int count, SimTime_t end)
+{
+    global_count = count;
+    if ( !count ) end_time = end;
+}
+
 // bool Exit::handler( Event* e )
 void
 Exit::check()
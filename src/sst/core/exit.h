@@ -72,6 +72,14 @@ public:
 
     unsigned int getGlobalCount() { return global_count; }
 
+    /**
+     * Record the exit state reduced across ranks by the rank sync, in
+     * place of the reduction done by check()
+     * @param count Number of ranks that still have references
+     * @param end_time Latest end time across ranks
+     */
+    void setGlobalState(unsigned int count, SimTime_t end_time);
+
 private:
     Exit() {}                    // for serialization only
     Exit(const Exit&);           // Don't implement
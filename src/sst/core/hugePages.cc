@@ -0,0 +1,121 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/hugePages.h"
+
+#include "sst/core/output.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <locale>
+#include <sys/mman.h>
+
+namespace SST {
+namespace Core {
+
+HugePages::Mode HugePages::mode = HugePages::Mode::NONE;
+
+namespace {
+std::atomic<bool> explicit_fallback_warned(false);
+
+// Map size bytes aligned to the huge page size by over mapping and
+// trimming the ends
+void*
+mapAligned(size_t size)
+{
+    size_t   span = size + HugePages::page_size;
+    uint8_t* base = (uint8_t*)mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    if ( MAP_FAILED == base ) return nullptr;
+
+    uintptr_t addr    = (uintptr_t)base;
+    uint8_t*  aligned = (uint8_t*)((addr + HugePages::page_size - 1) & ~(uintptr_t)(HugePages::page_size - 1));
+    size_t    head    = aligned - base;
+    size_t    tail    = span - head - size;
+    if ( head ) munmap(base, head);
+    if ( tail ) munmap(aligned + size, tail);
+    return aligned;
+}
+} // anonymous namespace
+
+bool
+HugePages::setMode(const std::string& mode_str)
+{
+    std::string lower(mode_str);
+    std::locale loc;
+    for ( auto& ch : lower )
+        ch = std::tolower(ch, loc);
+
+    if ( lower == "none" )
+        mode = Mode::NONE;
+    else if ( lower == "transparent" )
+        mode = Mode::TRANSPARENT;
+    else if ( lower == "explicit" )
+        mode = Mode::EXPLICIT;
+    else
+        return false;
+    return true;
+}
+
+size_t
+HugePages::mappedSize(size_t size)
+{
+    if ( mode == Mode::NONE ) return size;
+    return (size + page_size - 1) & ~(page_size - 1);
+}
+
+void*
+HugePages::map(size_t size)
+{
+    size = mappedSize(size);
+
+    void* ret = nullptr;
+    switch ( mode ) {
+    case Mode::NONE:
+        ret = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if ( MAP_FAILED == ret ) return nullptr;
+        break;
+    case Mode::EXPLICIT:
+#ifdef MAP_HUGETLB
+        ret = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0);
+        if ( MAP_FAILED != ret ) break;
+#endif
+        if ( !explicit_fallback_warned.exchange(true) ) {
+            Output::getDefaultObject().output(
+                "WARNING: Unable to map explicit huge pages, using transparent huge pages instead.  Check that "
+                "huge pages are reserved (/proc/sys/vm/nr_hugepages)\n");
+        }
+        [[fallthrough]];
+    case Mode::TRANSPARENT:
+        ret = mapAligned(size);
+        if ( nullptr == ret ) return nullptr;
+#ifdef MADV_HUGEPAGE
+        madvise(ret, size, MADV_HUGEPAGE);
+#endif
+        break;
+    }
+
+    // Touch the memory from this thread so it is placed on this
+    // thread's NUMA node
+    std::memset(ret, 0, size);
+    return ret;
+}
+
+void
+HugePages::unmap(void* ptr, size_t size)
+{
+    munmap(ptr, mappedSize(size));
+}
+
+} // namespace Core
+} // namespace SST
@@ -0,0 +1,123 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_HUGEPAGES_H
+#define SST_CORE_HUGEPAGES_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+
+namespace SST {
+namespace Core {
+
+/**
+ * Maps the large, long lived blocks of memory used by the core
+ * (mempool arenas and TimeVortex storage), optionally backed by huge
+ * pages to cut TLB misses.
+ *
+ * Memory is touched by the thread that maps it.  Since each simulation
+ * thread maps its own arenas and grows its own TimeVortex, the kernel's
+ * first touch policy places the memory on that thread's NUMA node.
+ */
+class HugePages
+{
+public:
+    enum class Mode {
+        NONE,        /*!< Use regular pages */
+        TRANSPARENT, /*!< Align to huge pages and ask for transparent huge pages with madvise() */
+        EXPLICIT     /*!< Map from the reserved huge page pool, falling back to TRANSPARENT if it is empty */
+    };
+
+    /** Size of a huge page */
+    static constexpr size_t page_size = 2 << 20;
+
+    /**
+     * Set the mode from the value of the --huge-pages option (NONE,
+     * TRANSPARENT or EXPLICIT).  Must be called before any memory is
+     * mapped, since unmap() depends on the mode.
+     * @return false if the mode is not valid
+     */
+    static bool setMode(const std::string& mode);
+    static Mode getMode() { return mode; }
+
+    /**
+     * Map size bytes of zeroed anonymous memory.  If huge pages are
+     * enabled, size is rounded up to a multiple of page_size and the
+     * memory is aligned to page_size.
+     * @return pointer to the memory, or nullptr if it could not be mapped
+     */
+    static void* map(size_t size);
+
+    /** Unmap memory returned by map() */
+    static void unmap(void* ptr, size_t size);
+
+    /** Size that map() actually maps for a request of size bytes */
+    static size_t mappedSize(size_t size);
+
+private:
+    static Mode mode;
+};
+
+/**
+ * Allocator for containers that can grow large, such as the
+ * TimeVortex heaps.  When huge pages are enabled, allocations of at
+ * least HugePages::page_size bytes come from HugePages::map().  All
+ * other allocations use the default allocator.
+ */
+template <typename T>
+class HugePageAllocator
+{
+public:
+    using value_type = T;
+
+    HugePageAllocator() = default;
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&)
+    {}
+
+    T* allocate(size_t n)
+    {
+        if ( !useHugePages(n) ) return std::allocator<T>().allocate(n);
+        T* ret = static_cast<T*>(HugePages::map(n * sizeof(T)));
+        if ( nullptr == ret ) throw std::bad_alloc();
+        return ret;
+    }
+
+    void deallocate(T* ptr, size_t n)
+    {
+        if ( !useHugePages(n) ) return std::allocator<T>().deallocate(ptr, n);
+        HugePages::unmap(ptr, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const HugePageAllocator<U>&) const
+    {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const HugePageAllocator<U>&) const
+    {
+        return false;
+    }
+
+private:
+    static bool useHugePages(size_t n)
+    {
+        return HugePages::getMode() != HugePages::Mode::NONE && n * sizeof(T) >= HugePages::page_size;
+    }
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_HUGEPAGES_H
@@ -0,0 +1,618 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cmath>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+namespace {
+
+// Stop coarsening once a graph has this few vertices
+const uint32_t coarsen_to = 128;
+
+// Number of initial bisections tried on the coarsest graph
+const int initial_tries = 4;
+
+// Maximum number of Fiduccia-Mattheyses passes per level
+const int fm_passes = 8;
+
+// Number of moves a Fiduccia-Mattheyses pass will make without
+// improving on the best cut seen before giving up
+const size_t fm_max_bad_moves = 100;
+
+// Edge weight given to the lowest latency links, or the busiest links
+// when traffic was measured.  Other links are weighted in proportion.
+const double max_edge_weight = 1024.0;
+
+const uint32_t unmatched = ~0u;
+
+/** Graph in compressed sparse row form */
+struct MLGraph
+{
+    vector<uint64_t> xadj;   // Start of each vertex's edges in adjncy, size() + 1 entries
+    vector<uint32_t> adjncy; // Neighbor at the other end of each edge
+    vector<int64_t>  adjwgt; // Weight of each edge
+    vector<double>   vwgt;   // Weight of each vertex
+
+    uint32_t size() const { return vwgt.size(); }
+
+    double totalWeight() const { return std::accumulate(vwgt.begin(), vwgt.end(), 0.0); }
+
+    void clear()
+    {
+        vector<uint64_t>().swap(xadj);
+        vector<uint32_t>().swap(adjncy);
+        vector<int64_t>().swap(adjwgt);
+        vector<double>().swap(vwgt);
+    }
+};
+
+/** State of a bisection being refined */
+struct Bisection
+{
+    vector<uint8_t> side;
+    double          pw[2];   // Weight of each side
+    double          maxw[2]; // Largest weight each side may have
+    int64_t         cut;
+
+    // Amount the sides are over their maximum weights
+    double overweight() const { return std::max(0.0, pw[0] - maxw[0]) + std::max(0.0, pw[1] - maxw[1]); }
+
+    bool betterThan(double other_overweight, int64_t other_cut) const
+    {
+        double ow = overweight();
+        if ( ow != other_overweight ) return ow < other_overweight;
+        return cut < other_cut;
+    }
+};
+
+int64_t
+computeCut(const MLGraph& g, const vector<uint8_t>& side)
+{
+    int64_t cut = 0;
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            if ( side[v] != side[g.adjncy[e]] ) cut += g.adjwgt[e];
+        }
+    }
+    return cut / 2;
+}
+
+void
+computeWeights(const MLGraph& g, Bisection& b)
+{
+    b.pw[0] = b.pw[1] = 0.0;
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        b.pw[b.side[v]] += g.vwgt[v];
+    }
+    b.cut = computeCut(g, b.side);
+}
+
+/**
+ * Merge each vertex with the unmatched neighbor it shares the heaviest
+ * edge with, visiting the vertices in random order.  Fills in cmap
+ * with the coarse vertex each fine vertex becomes part of.
+ */
+void
+coarsen(const MLGraph& g, double max_vwgt, std::mt19937& rng, vector<uint32_t>& cmap, MLGraph& coarse)
+{
+    uint32_t n = g.size();
+
+    vector<uint32_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), rng);
+
+    vector<uint32_t> match(n, unmatched);
+    for ( uint32_t v : perm ) {
+        if ( match[v] != unmatched ) continue;
+
+        uint32_t best   = v;
+        int64_t  best_w = -1;
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( match[u] != unmatched || u == v ) continue;
+            if ( g.vwgt[v] + g.vwgt[u] > max_vwgt ) continue;
+            if ( g.adjwgt[e] > best_w ) {
+                best   = u;
+                best_w = g.adjwgt[e];
+            }
+        }
+        match[v]    = best;
+        match[best] = v;
+    }
+
+    cmap.resize(n);
+    uint32_t cn = 0;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( v <= match[v] ) cmap[v] = cmap[match[v]] = cn++;
+    }
+
+    // Build the coarse graph, merging the edges of each matched pair.
+    // where[] holds the position of the edge to each coarse neighbor
+    // of the vertex being built.
+    coarse.clear();
+    coarse.xadj.reserve(cn + 1);
+    coarse.vwgt.reserve(cn);
+    coarse.adjncy.reserve(g.adjncy.size() / 2);
+    coarse.adjwgt.reserve(g.adjncy.size() / 2);
+    coarse.xadj.push_back(0);
+
+    vector<int64_t> where(cn, -1);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( v > match[v] ) continue;
+        uint32_t c     = cmap[v];
+        uint64_t start = coarse.adjncy.size();
+
+        uint32_t pair[2] = { v, match[v] };
+        int      count   = pair[0] == pair[1] ? 1 : 2;
+        for ( int i = 0; i < count; i++ ) {
+            uint32_t x = pair[i];
+            for ( uint64_t e = g.xadj[x]; e < g.xadj[x + 1]; e++ ) {
+                uint32_t cy = cmap[g.adjncy[e]];
+                if ( cy == c ) continue;
+                if ( where[cy] < 0 ) {
+                    where[cy] = coarse.adjncy.size();
+                    coarse.adjncy.push_back(cy);
+                    coarse.adjwgt.push_back(g.adjwgt[e]);
+                }
+                else {
+                    coarse.adjwgt[where[cy]] += g.adjwgt[e];
+                }
+            }
+        }
+        for ( uint64_t e = start; e < coarse.adjncy.size(); e++ ) {
+            where[coarse.adjncy[e]] = -1;
+        }
+
+        coarse.xadj.push_back(coarse.adjncy.size());
+        coarse.vwgt.push_back(count == 1 ? g.vwgt[v] : g.vwgt[v] + g.vwgt[match[v]]);
+    }
+}
+
+/**
+ * Fiduccia-Mattheyses refinement.  Each pass moves the vertex with the
+ * best gain that keeps the sides within their maximum weights (or
+ * moves weight off of a side that is over), locking it for the rest of
+ * the pass, then rolls back to the best state seen.
+ */
+void
+refine(const MLGraph& g, Bisection& b)
+{
+    uint32_t n = g.size();
+
+    typedef std::pair<int64_t, uint32_t> entry_t;
+
+    vector<int64_t> gain(n);
+    vector<uint8_t> locked(n);
+    vector<uint32_t> moves;
+
+    for ( int pass = 0; pass < fm_passes; pass++ ) {
+        std::priority_queue<entry_t> heap[2];
+
+        // Gain of moving a vertex is the weight of its edges to the
+        // other side less the weight of its edges to its own side
+        for ( uint32_t v = 0; v < n; v++ ) {
+            int64_t ext = 0;
+            int64_t in  = 0;
+            for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+                if ( b.side[g.adjncy[e]] != b.side[v] ) ext += g.adjwgt[e];
+                else
+                    in += g.adjwgt[e];
+            }
+            gain[v]   = ext - in;
+            locked[v] = 0;
+            // Only vertices on the boundary are worth considering to
+            // start with, unless their side needs to lose weight.
+            // Others are added when a neighbor moves.
+            if ( ext > 0 || b.pw[b.side[v]] > b.maxw[b.side[v]] ) heap[b.side[v]].push(entry_t(gain[v], v));
+        }
+
+        // If the bisection starts over weight, any move off of the
+        // heavy side is allowed even if it increases the cut
+        double  best_ow   = b.overweight();
+        int64_t best_cut  = b.cut;
+        size_t  best_move = 0;
+        moves.clear();
+
+        while ( moves.size() - best_move < fm_max_bad_moves ) {
+            // Find the best valid move from each side
+            uint32_t cand[2]      = { unmatched, unmatched };
+            bool     cand_ok[2]   = { false, false };
+            bool     over_from[2] = { b.pw[0] > b.maxw[0], b.pw[1] > b.maxw[1] };
+            for ( int s = 0; s < 2; s++ ) {
+                while ( !heap[s].empty() ) {
+                    entry_t top = heap[s].top();
+                    if ( locked[top.second] || b.side[top.second] != s || gain[top.second] != top.first ) {
+                        heap[s].pop();
+                        continue;
+                    }
+                    cand[s]   = top.second;
+                    double nw = b.pw[1 - s] + g.vwgt[top.second];
+                    cand_ok[s] = nw <= b.maxw[1 - s] || (over_from[s] && nw < b.pw[s]);
+                    break;
+                }
+            }
+
+            int from;
+            if ( over_from[0] && cand_ok[0] ) { from = 0; }
+            else if ( over_from[1] && cand_ok[1] ) {
+                from = 1;
+            }
+            else if ( cand_ok[0] && cand_ok[1] ) {
+                from = gain[cand[0]] >= gain[cand[1]] ? 0 : 1;
+            }
+            else if ( cand_ok[0] ) {
+                from = 0;
+            }
+            else if ( cand_ok[1] ) {
+                from = 1;
+            }
+            else {
+                break;
+            }
+
+            uint32_t v = cand[from];
+            heap[from].pop();
+
+            // Move v and update its neighbors' gains
+            int to     = 1 - from;
+            b.side[v]  = to;
+            locked[v]  = 1;
+            b.pw[from] -= g.vwgt[v];
+            b.pw[to] += g.vwgt[v];
+            b.cut -= gain[v];
+            moves.push_back(v);
+
+            for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+                uint32_t u = g.adjncy[e];
+                // An edge to the side v left now counts against u if
+                // u is there, and for u if u is on the side v joined
+                if ( b.side[u] == from ) gain[u] += 2 * g.adjwgt[e];
+                else
+                    gain[u] -= 2 * g.adjwgt[e];
+                if ( !locked[u] ) heap[b.side[u]].push(entry_t(gain[u], u));
+            }
+
+            if ( b.betterThan(best_ow, best_cut) ) {
+                best_ow   = b.overweight();
+                best_cut  = b.cut;
+                best_move = moves.size();
+            }
+        }
+
+        // Undo everything after the best state
+        for ( size_t i = moves.size(); i > best_move; i-- ) {
+            uint32_t v = moves[i - 1];
+            int      s = b.side[v];
+            b.side[v]  = 1 - s;
+            b.pw[s] -= g.vwgt[v];
+            b.pw[1 - s] += g.vwgt[v];
+        }
+        b.cut = best_cut;
+
+        if ( best_move == 0 ) break;
+    }
+}
+
+/**
+ * Bisect the coarsest graph by growing side 0 breadth first from a
+ * random vertex until it reaches its target weight
+ */
+void
+growBisection(const MLGraph& g, double target0, std::mt19937& rng, Bisection& b)
+{
+    uint32_t n = g.size();
+    b.side.assign(n, 1);
+
+    vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    double               pw0 = 0.0;
+    vector<uint8_t>      visited(n, 0);
+    std::queue<uint32_t> q;
+    size_t               next_seed = 0;
+    while ( pw0 < target0 ) {
+        if ( q.empty() ) {
+            // Start again from an unvisited vertex to cover disconnected
+            // pieces of the graph
+            while ( next_seed < n && visited[order[next_seed]] )
+                next_seed++;
+            if ( next_seed == n ) break;
+            visited[order[next_seed]] = 1;
+            q.push(order[next_seed]);
+        }
+        uint32_t v = q.front();
+        q.pop();
+        b.side[v] = 0;
+        pw0 += g.vwgt[v];
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( !visited[u] ) {
+                visited[u] = 1;
+                q.push(u);
+            }
+        }
+    }
+    computeWeights(g, b);
+}
+
+/**
+ * Multilevel bisection of g.  Side 0 gets a fraction frac of the vertex
+ * weight.  Returns the side of each vertex.
+ */
+vector<uint8_t>
+bisect(const MLGraph& g, double frac, double imbalance, std::mt19937& rng)
+{
+    double total   = g.totalWeight();
+    double target0 = total * frac;
+    double target1 = total - target0;
+
+    // Allow at least one vertex worth of slack, since a single vertex
+    // may be heavier than the allowed imbalance
+    double max_vwgt = g.size() ? *std::max_element(g.vwgt.begin(), g.vwgt.end()) : 0.0;
+    double maxw0    = std::max(target0 * (1.0 + imbalance), target0 + max_vwgt);
+    double maxw1    = std::max(target1 * (1.0 + imbalance), target1 + max_vwgt);
+
+    // Coarsen
+    vector<MLGraph>          levels;
+    vector<vector<uint32_t>> cmaps;
+    const MLGraph*           cur             = &g;
+    double                   max_merge_wgt   = std::max(1.5 * total / coarsen_to, max_vwgt);
+    while ( cur->size() > coarsen_to ) {
+        vector<uint32_t> cmap;
+        MLGraph          next;
+        coarsen(*cur, max_merge_wgt, rng, cmap, next);
+        // Stop if the graph is not getting any smaller
+        if ( next.size() > cur->size() * 0.95 ) break;
+        levels.push_back(std::move(next));
+        cmaps.push_back(std::move(cmap));
+        cur = &levels.back();
+    }
+
+    // Initial bisection, keeping the best of several tries
+    Bisection best;
+    for ( int i = 0; i < initial_tries; i++ ) {
+        Bisection b;
+        b.maxw[0] = maxw0;
+        b.maxw[1] = maxw1;
+        growBisection(*cur, target0, rng, b);
+        refine(*cur, b);
+        if ( i == 0 || b.betterThan(best.overweight(), best.cut) ) best = std::move(b);
+    }
+
+    // Project back up through the levels, refining at each one
+    for ( size_t l = levels.size(); l > 0; l-- ) {
+        const MLGraph&          fine = l > 1 ? levels[l - 2] : g;
+        const vector<uint32_t>& cmap = cmaps[l - 1];
+
+        vector<uint8_t> side(fine.size());
+        for ( uint32_t v = 0; v < fine.size(); v++ ) {
+            side[v] = best.side[cmap[v]];
+        }
+        best.side = std::move(side);
+        levels[l - 1].clear();
+
+        computeWeights(fine, best);
+        refine(fine, best);
+    }
+
+    return best.side;
+}
+
+/** Extract the subgraph of the vertices on one side of a bisection */
+void
+extract(
+    const MLGraph& g, const vector<uint32_t>& ids, const vector<uint8_t>& side, uint8_t s, MLGraph& sub,
+    vector<uint32_t>& sub_ids)
+{
+    vector<uint32_t> local(g.size(), unmatched);
+    sub.clear();
+    sub_ids.clear();
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        if ( side[v] != s ) continue;
+        local[v] = sub_ids.size();
+        sub_ids.push_back(ids[v]);
+        sub.vwgt.push_back(g.vwgt[v]);
+    }
+
+    sub.xadj.reserve(sub_ids.size() + 1);
+    sub.xadj.push_back(0);
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        if ( side[v] != s ) continue;
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( side[u] != s ) continue;
+            sub.adjncy.push_back(local[u]);
+            sub.adjwgt.push_back(g.adjwgt[e]);
+        }
+        sub.xadj.push_back(sub.adjncy.size());
+    }
+}
+
+/**
+ * Split g into k parts numbered from first_part, putting the part of
+ * each vertex into parts (indexed by the original vertex id in ids).
+ * g and ids are consumed.
+ */
+void
+partitionRecursive(
+    MLGraph& g, vector<uint32_t>& ids, uint32_t k, uint32_t first_part, double imbalance, std::mt19937& rng,
+    vector<uint32_t>& parts)
+{
+    if ( k == 1 || g.size() == 0 ) {
+        for ( uint32_t id : ids ) {
+            parts[id] = first_part;
+        }
+        return;
+    }
+
+    uint32_t        k0   = k / 2;
+    vector<uint8_t> side = bisect(g, (double)k0 / k, imbalance, rng);
+
+    MLGraph          sub[2];
+    vector<uint32_t> sub_ids[2];
+    extract(g, ids, side, 0, sub[0], sub_ids[0]);
+    extract(g, ids, side, 1, sub[1], sub_ids[1]);
+    g.clear();
+    vector<uint32_t>().swap(ids);
+    vector<uint8_t>().swap(side);
+
+    partitionRecursive(sub[0], sub_ids[0], k0, first_part, imbalance, rng, parts);
+    partitionRecursive(sub[1], sub_ids[1], k - k0, first_part + k0, imbalance, rng, parts);
+}
+
+} // namespace
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo mpiranks, RankInfo UNUSED(my_rank), int verbosity)
+{
+    rankcount  = mpiranks;
+    partOutput = new Output("MultilevelPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTMultilevelPartition::~SSTMultilevelPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* graph)
+{
+    assert(rankcount.rank > 0);
+
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+    PartitionLinkMap_t&      linkMap = graph->getLinkMap();
+
+    uint32_t num_parts = rankcount.rank * rankcount.thread;
+    uint32_t n         = compMap.size();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition scheme for simulation model.\n");
+    partOutput->verbose(CALL_INFO, 1, 0, "- Vertex Count:                     %10" PRIu32 "\n", n);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Edge Count:                       %10zu\n", linkMap.size());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", num_parts);
+
+    // Edge weights are proportional to the measured traffic on the
+    // link if there is any (see --partition-costs), otherwise they
+    // are inversely proportional to the link latency
+    SimTime_t min_latency = MAX_SIMTIME_T;
+    double    max_traffic = 0.0;
+    for ( PartitionLinkMap_t::iterator it = linkMap.begin(); it != linkMap.end(); ++it ) {
+        SimTime_t lat = it->getMinLatency();
+        if ( lat > 0 && lat < min_latency ) min_latency = lat;
+        max_traffic = std::max(max_traffic, (double)it->weight);
+    }
+    auto edgeWeight = [min_latency, max_traffic](const PartitionLink& link) -> int64_t {
+        if ( max_traffic > 0.0 ) {
+            return std::max((int64_t)1, (int64_t)std::llround(max_edge_weight * link.weight / max_traffic));
+        }
+        SimTime_t lat = link.getMinLatency();
+        if ( lat <= min_latency ) return (int64_t)max_edge_weight;
+        return std::max((int64_t)1, (int64_t)std::llround(max_edge_weight * min_latency / lat));
+    };
+
+    // Find the two vertices joined by each link.  The component ids in
+    // the links can't be used for this, since only the ones for
+    // top-level components have been changed to the id of their
+    // PartitionComponent.  Instead, every link is in the links list of
+    // the PartitionComponents at both of its ends.
+    struct Edge
+    {
+        uint32_t a;
+        uint32_t b;
+        int64_t  weight;
+    };
+    vector<Edge>                           edges;
+    std::unordered_map<LinkId_t, uint32_t> first_end;
+    uint32_t                               index = 0;
+    for ( PartitionComponentMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it, ++index ) {
+        for ( LinkIdMap_t::iterator l = (*it)->links.begin(); l != (*it)->links.end(); ++l ) {
+            auto end = first_end.emplace(*l, index);
+            if ( !end.second && end.first->second != index ) {
+                edges.push_back({ end.first->second, index, edgeWeight(linkMap[*l]) });
+            }
+        }
+    }
+    std::unordered_map<LinkId_t, uint32_t>().swap(first_end);
+
+    // Build the graph
+    MLGraph g;
+    g.vwgt.reserve(n);
+    for ( PartitionComponentMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it ) {
+        g.vwgt.push_back((*it)->weight);
+    }
+
+    vector<uint64_t> degree(n + 1, 0);
+    for ( const Edge& e : edges ) {
+        degree[e.a + 1]++;
+        degree[e.b + 1]++;
+    }
+    std::partial_sum(degree.begin(), degree.end(), degree.begin());
+    g.xadj = degree;
+    g.adjncy.resize(g.xadj[n]);
+    g.adjwgt.resize(g.xadj[n]);
+    for ( const Edge& e : edges ) {
+        g.adjncy[degree[e.a]] = e.b;
+        g.adjwgt[degree[e.a]] = e.weight;
+        degree[e.a]++;
+        g.adjncy[degree[e.b]] = e.a;
+        g.adjwgt[degree[e.b]] = e.weight;
+        degree[e.b]++;
+    }
+    vector<uint64_t>().swap(degree);
+
+    // Spread the total allowed imbalance of 5% over the levels of
+    // bisection
+    int    depth     = (int)std::ceil(std::log2((double)std::max(num_parts, 2u)));
+    double imbalance = std::pow(1.05, 1.0 / depth) - 1.0;
+
+    vector<uint32_t> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    vector<uint32_t> parts(n, 0);
+
+    // Fixed seed so that partitions are reproducible
+    std::mt19937 rng(0x5375);
+    partitionRecursive(g, ids, num_parts, 0, imbalance, rng, parts);
+
+    // Parts from the same bisection are numbered consecutively, so
+    // give consecutive parts to the threads of a rank
+    index = 0;
+    for ( PartitionComponentMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it, ++index ) {
+        (*it)->rank = RankInfo(parts[index] / rankcount.thread, parts[index] % rankcount.thread);
+    }
+
+    if ( partOutput->getVerboseLevel() >= 1 ) {
+        // Report the cut in terms of links
+        uint64_t cut_links = 0;
+        for ( const Edge& e : edges ) {
+            if ( parts[e.a] != parts[e.b] ) cut_links++;
+        }
+        partOutput->verbose(CALL_INFO, 1, 0, "- Links Cut:                        %10" PRIu64 "\n", cut_links);
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
@@ -0,0 +1,88 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a multilevel partition of an SST simulation configuration.  The
+graph is split into one part per thread of every rank by recursive
+bisection.  Each bisection coarsens the graph by repeatedly merging
+vertices across their heaviest edges (heavy-edge matching), bisects the
+coarsest graph, then projects the bisection back up through the levels,
+refining it with Fiduccia-Mattheyses moves at each one.
+
+Edges are weighted by the inverse of the link latency, so low latency
+links, which limit how far apart the partitions can run, are the most
+expensive to cut.  If the link traffic was measured by an earlier run
+(--partition-costs), edges are weighted by the traffic instead.
+Vertices are weighted by the component weight.
+Components joined by no-cut links are collapsed into a single vertex
+by the core before the partitioner sees the graph, so they always end
+up together.
+
+Parts that come out of the same bisection are given consecutive thread
+numbers on the same rank, so the threads of a rank hold neighboring
+pieces of the graph and the cut between ranks is made at the top
+levels of the recursion.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel recursive bisection partitioner (heavy-edge matching, Fiduccia-Mattheyses refinement) "
+        "that minimizes the number of low latency links cut while balancing component weights.")
+
+protected:
+    /** Number of ranks in the simulation */
+    RankInfo rankcount;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+
+public:
+    /**
+       Creates a new multilevel partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTMultilevelPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif
@@ -0,0 +1,303 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexCalendar.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace IMPL {
+
+// Buckets are kept as heaps.  The STL heap functions put the
+// "largest" item at the front, so use greater to get the earliest
+// activity at the front of each bucket.
+static Activity::greater<true, true, true> calendar_compare;
+
+// Never shrink the calendar below this many buckets
+static const size_t min_buckets = 16;
+
+// Number of activities used to estimate the bucket width
+static const size_t width_sample_size = 25;
+
+template <bool TS>
+TimeVortexCalendarBase<TS>::TimeVortexCalendarBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    buckets(min_buckets),
+    bucket_mask(min_buckets - 1),
+    shift(0),
+    current_bucket(0),
+    bucket_base(0),
+    grow_threshold(2 * min_buckets),
+    shrink_threshold(0),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0)
+{}
+
+template <bool TS>
+TimeVortexCalendarBase<TS>::~TimeVortexCalendarBase()
+{
+    // Activities in TimeVortexCalendar all need to be deleted
+    for ( auto& bucket : buckets ) {
+        for ( auto x : bucket ) {
+            delete x;
+        }
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexCalendarBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexCalendarBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexCalendarBase<TS>::enqueue(Activity* activity)
+{
+    SimTime_t time = activity->getDeliveryTime();
+
+    // If this activity is earlier than the bucket we are currently
+    // dequeuing from, move the calendar back so it will be found.
+    // This can't happen in a normal simulation since time never goes
+    // backwards, but it keeps the queue correct for any use.
+    if ( UNLIKELY(time < bucket_base) ) {
+        current_bucket = bucketIndex(time);
+        bucket_base    = bucketBase(time);
+    }
+
+    bucket_t& bucket = buckets[bucketIndex(time)];
+    bucket.push_back(activity);
+    std::push_heap(bucket.begin(), bucket.end(), calendar_compare);
+}
+
+template <bool TS>
+void
+TimeVortexCalendarBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+    enqueue(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( UNLIKELY(current_depth > grow_threshold) ) { resize(buckets.size() * 2); }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+int
+TimeVortexCalendarBase<TS>::findNext(size_t& bucket, SimTime_t& base) const
+{
+    if ( current_depth == 0 ) return -1;
+
+    // Look through one year worth of buckets for an activity that
+    // falls in the current year.  Nothing is queued before base, so
+    // the subtraction can't underflow.
+    SimTime_t width = (SimTime_t)1 << shift;
+    for ( size_t i = 0; i < buckets.size(); ++i ) {
+        const bucket_t& b = buckets[bucket];
+        if ( !b.empty() && b.front()->getDeliveryTime() - base < width ) return bucket;
+        // Nothing can be queued past the last bucket below
+        // MAX_SIMTIME_T, so stop rather than wrap
+        if ( base > MAX_SIMTIME_T - width ) break;
+        bucket = (bucket + 1) & bucket_mask;
+        base += width;
+    }
+
+    // Nothing in the next year, so do a direct search for the
+    // earliest activity and jump the calendar to it
+    Activity* next = nullptr;
+    for ( size_t i = 0; i < buckets.size(); ++i ) {
+        if ( buckets[i].empty() ) continue;
+        if ( next == nullptr || calendar_compare(next, buckets[i].front()) ) {
+            next   = buckets[i].front();
+            bucket = i;
+        }
+    }
+    base = bucketBase(next->getDeliveryTime());
+    return bucket;
+}
+
+template <bool TS>
+Activity*
+TimeVortexCalendarBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    int index = findNext(current_bucket, bucket_base);
+    if ( index < 0 ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    bucket_t& bucket = buckets[index];
+    std::pop_heap(bucket.begin(), bucket.end(), calendar_compare);
+    Activity* ret_val = bucket.back();
+    bucket.pop_back();
+    current_depth--;
+    if ( UNLIKELY(current_depth < shrink_threshold) ) { resize(buckets.size() / 2); }
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexCalendarBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    size_t    bucket = current_bucket;
+    SimTime_t base   = bucket_base;
+    int       index  = findNext(bucket, base);
+    Activity* ret    = index < 0 ? nullptr : buckets[index].front();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexCalendarBase<TS>::computeShift(std::vector<Activity*>& activities)
+{
+    if ( activities.size() < 2 ) return shift;
+
+    // Get the earliest activities in sorted order
+    size_t sample = std::min(activities.size(), width_sample_size);
+    std::partial_sort(
+        activities.begin(), activities.begin() + sample, activities.end(), Activity::less<true, false, false>());
+
+    // Average separation of the sample, then recompute ignoring
+    // outliers, which would otherwise make the buckets too wide
+    SimTime_t total = activities[sample - 1]->getDeliveryTime() - activities[0]->getDeliveryTime();
+    if ( total == 0 ) return shift;
+    double avg = (double)total / (sample - 1);
+
+    double   trimmed_total = 0.0;
+    uint64_t count         = 0;
+    for ( size_t i = 1; i < sample; ++i ) {
+        SimTime_t sep = activities[i]->getDeliveryTime() - activities[i - 1]->getDeliveryTime();
+        if ( sep <= 2.0 * avg ) {
+            trimmed_total += sep;
+            count++;
+        }
+    }
+    if ( count > 0 && trimmed_total > 0.0 ) avg = trimmed_total / count;
+
+    // Use three times the average separation, rounded up to a power
+    // of two
+    SimTime_t width     = (SimTime_t)(3.0 * avg);
+    int       new_shift = 0;
+    while ( new_shift < 63 && ((SimTime_t)1 << new_shift) < width ) {
+        new_shift++;
+    }
+    return new_shift;
+}
+
+template <bool TS>
+void
+TimeVortexCalendarBase<TS>::resize(size_t new_num_buckets)
+{
+    if ( new_num_buckets < min_buckets ) new_num_buckets = min_buckets;
+
+    // Pull everything out of the current calendar
+    std::vector<Activity*> activities;
+    activities.reserve(current_depth);
+    for ( auto& bucket : buckets ) {
+        activities.insert(activities.end(), bucket.begin(), bucket.end());
+        bucket.clear();
+    }
+
+    shift       = computeShift(activities);
+    bucket_mask = new_num_buckets - 1;
+    buckets.resize(new_num_buckets);
+
+    grow_threshold   = 2 * new_num_buckets;
+    shrink_threshold = new_num_buckets > min_buckets ? new_num_buckets / 2 - 2 : 0;
+
+    // Start the calendar at the earliest activity.  computeShift()
+    // leaves it at the front of the vector if it sorted anything, but
+    // search anyway since it may not have.
+    SimTime_t start = 0;
+    if ( !activities.empty() ) {
+        start = (*std::min_element(
+                     activities.begin(), activities.end(), Activity::less<true, false, false>()))
+                    ->getDeliveryTime();
+    }
+    current_bucket = bucketIndex(start);
+    bucket_base    = bucketBase(start);
+
+    for ( auto x : activities ) {
+        enqueue(x);
+    }
+}
+
+template <bool TS>
+void
+TimeVortexCalendarBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output(
+        "  %zu buckets of width %" PRIu64 ", current bucket = %zu\n", buckets.size(), (SimTime_t)1 << shift,
+        current_bucket);
+
+    // Buckets are heaps, so activities are only partially ordered
+    for ( size_t i = 0; i < buckets.size(); ++i ) {
+        for ( auto x : buckets[i] ) {
+            out.output("  [%zu] %s\n", i, x->toString().c_str());
+        }
+    }
+}
+
+class TimeVortexCalendar : public TimeVortexCalendarBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexCalendar,
+        "sst",
+        "timevortex.calendar",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex based on a calendar queue with bucket width sized from the spread of delivery times.")
+
+
+    TimeVortexCalendar(Params& params) : TimeVortexCalendarBase<false>(params) {}
+    ~TimeVortexCalendar() {}
+    SST_ELI_EXPORT(TimeVortexCalendar)
+};
+
+class TimeVortexCalendar_ts : public TimeVortexCalendarBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexCalendar_ts,
+        "sst",
+        "timevortex.calendar.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread safe verion of TimeVortex based on a calendar queue.  Do not reference this element directly, just specify sst.timevortex.calendar and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexCalendar_ts(Params& params) : TimeVortexCalendarBase<true>(params) {}
+    ~TimeVortexCalendar_ts() {}
+    SST_ELI_EXPORT(TimeVortexCalendar_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,117 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCALENDAR_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCALENDAR_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue implemented as a calendar queue.
+ *
+ * Activities are hashed into a circular array of buckets based on
+ * their delivery time.  Each bucket covers a fixed width of time
+ * (always a power of two so the bucket index can be computed with a
+ * shift and a mask) and the array as a whole covers one "year".
+ * Each bucket is kept as a small heap so that activities with the
+ * same delivery time still come out in priority and insertion order.
+ * The number of buckets tracks the number of queued activities and
+ * the bucket width is resized from the observed spread of delivery
+ * times, which gives O(1) amortized insert and pop.
+ */
+template <bool TS>
+class TimeVortexCalendarBase : public TimeVortex
+{
+
+public:
+    TimeVortexCalendarBase(Params& params);
+    ~TimeVortexCalendarBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    typedef std::vector<Activity*> bucket_t;
+
+    /** Returns the index of the bucket holding the next activity, or
+     * -1 if the queue is empty.  The search starts at the passed in
+     * bucket and bucket base, which are advanced as the search
+     * progresses.  front() can be called from multiple threads
+     * during sync, so it must search with copies rather than move
+     * the calendar itself. */
+    int findNext(size_t& bucket, SimTime_t& base) const;
+
+    /** Add an activity to its bucket without checking queue size */
+    void enqueue(Activity* activity);
+
+    /** Rebuild the calendar with the given number of buckets,
+     * recomputing the bucket width from the queued activities */
+    void resize(size_t new_num_buckets);
+
+    /** Estimate a bucket width from the spread of the earliest
+     * activities in the queue */
+    int computeShift(std::vector<Activity*>& activities);
+
+    inline size_t bucketIndex(SimTime_t time) const { return (time >> shift) & bucket_mask; }
+
+    inline SimTime_t bucketBase(SimTime_t time) const { return (time >> shift) << shift; }
+
+    // Data
+    std::vector<bucket_t> buckets;
+    size_t                bucket_mask;
+    // Bucket width is (1 << shift)
+    int                   shift;
+
+    // Index of the bucket currently being dequeued and the start of
+    // the time range it covers in the current year.  The start is kept
+    // rather than the end so that the last bucket below MAX_SIMTIME_T
+    // doesn't wrap.
+    size_t    current_bucket;
+    SimTime_t bucket_base;
+
+    // Queue sizes at which the calendar will be resized
+    size_t grow_threshold;
+    size_t shrink_threshold;
+
+    uint64_t insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCALENDAR_H
@@ -0,0 +1,189 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexDaryHeap.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexDaryHeapBase<TS>::TimeVortexDaryHeapBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0)
+{
+    data.reserve(1024);
+}
+
+template <bool TS>
+TimeVortexDaryHeapBase<TS>::~TimeVortexDaryHeapBase()
+{
+    // Activities in TimeVortexDaryHeap all need to be deleted
+    for ( auto& entry : data ) {
+        delete entry.activity;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexDaryHeapBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexDaryHeapBase<TS>::size()
+{
+    return current_depth;
+}
+
+// Move the hole at index up until entry can be placed in it
+template <bool TS>
+void
+TimeVortexDaryHeapBase<TS>::siftUp(size_t index, const HeapEntry& entry)
+{
+    while ( index > 0 ) {
+        size_t parent = (index - 1) / arity;
+        if ( !(entry < data[parent]) ) break;
+        data[index] = data[parent];
+        index       = parent;
+    }
+    data[index] = entry;
+}
+
+// Move the hole at index down until entry can be placed in it
+template <bool TS>
+void
+TimeVortexDaryHeapBase<TS>::siftDown(size_t index, const HeapEntry& entry)
+{
+    size_t num = data.size();
+    while ( true ) {
+        size_t first_child = index * arity + 1;
+        if ( first_child >= num ) break;
+
+        // Find the smallest child
+        size_t last_child = first_child + arity < num ? first_child + arity : num;
+        size_t min_child  = first_child;
+        for ( size_t child = first_child + 1; child < last_child; ++child ) {
+            if ( data[child] < data[min_child] ) min_child = child;
+        }
+
+        if ( !(data[min_child] < entry) ) break;
+        data[index] = data[min_child];
+        index       = min_child;
+    }
+    data[index] = entry;
+}
+
+template <bool TS>
+void
+TimeVortexDaryHeapBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+
+    HeapEntry entry;
+    entry.delivery_time  = activity->getDeliveryTime();
+    entry.priority_order = ((uint64_t)(uint32_t)activity->getPriority() << 32) | activity->getOrderTag();
+    entry.queue_order    = activity->getQueueOrder();
+    entry.activity       = activity;
+
+    data.emplace_back();
+    siftUp(data.size() - 1, entry);
+
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexDaryHeapBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( data.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = data.front().activity;
+    HeapEntry last    = data.back();
+    data.pop_back();
+    if ( !data.empty() ) siftDown(0, last);
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexDaryHeapBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.empty() ? nullptr : data.front().activity;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexDaryHeapBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    // Entries are in heap order, not delivery order
+    for ( auto& entry : data ) {
+        out.output("  %s\n", entry.activity->toString().c_str());
+    }
+}
+
+class TimeVortexDaryHeap : public TimeVortexDaryHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDaryHeap,
+        "sst",
+        "timevortex.dary_heap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex based on a 4-ary heap that stores the sort keys inline.")
+
+
+    TimeVortexDaryHeap(Params& params) : TimeVortexDaryHeapBase<false>(params) {}
+    ~TimeVortexDaryHeap() {}
+    SST_ELI_EXPORT(TimeVortexDaryHeap)
+};
+
+class TimeVortexDaryHeap_ts : public TimeVortexDaryHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDaryHeap_ts,
+        "sst",
+        "timevortex.dary_heap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread safe verion of TimeVortex based on a 4-ary heap.  Do not reference this element directly, just specify sst.timevortex.dary_heap and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexDaryHeap_ts(Params& params) : TimeVortexDaryHeapBase<true>(params) {}
+    ~TimeVortexDaryHeap_ts() {}
+    SST_ELI_EXPORT(TimeVortexDaryHeap_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,96 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDARYHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDARYHEAP_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/hugePages.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue implemented as a d-ary heap with the sort keys
+ * stored inline.
+ *
+ * Each heap entry holds a copy of the delivery time, priority/order
+ * tag and queue order along with the Activity pointer, so sifting
+ * only ever reads the contiguous heap array and never dereferences
+ * the Activity.  The heap has a fan-out of four, which keeps the
+ * children of a node within two cache lines and halves the depth of
+ * the heap compared to a binary heap.
+ */
+template <bool TS>
+class TimeVortexDaryHeapBase : public TimeVortex
+{
+
+public:
+    TimeVortexDaryHeapBase(Params& params);
+    ~TimeVortexDaryHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    struct HeapEntry
+    {
+        SimTime_t delivery_time;
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        inline bool operator<(const HeapEntry& rhs) const
+        {
+            if ( delivery_time != rhs.delivery_time ) return delivery_time < rhs.delivery_time;
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    static const size_t arity = 4;
+
+    void siftUp(size_t index, const HeapEntry& entry);
+    void siftDown(size_t index, const HeapEntry& entry);
+
+    // Data
+    std::vector<HeapEntry, Core::HugePageAllocator<HeapEntry>> data;
+    uint64_t                                                   insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDARYHEAP_H
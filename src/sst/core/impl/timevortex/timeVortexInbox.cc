@@ -0,0 +1,208 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexInbox.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
+
+namespace SST {
+namespace IMPL {
+
+// Thread rank of the calling thread.  Looked up the first time a
+// thread inserts into another thread's TimeVortex and cached, since
+// Simulation_impl::getSimulation() is a map lookup.
+static thread_local int inbox_thread_index = -1;
+
+static inline int
+getInboxThreadIndex()
+{
+    if ( UNLIKELY(inbox_thread_index < 0) ) {
+        inbox_thread_index = Simulation_impl::getSimulation()->getRank().thread;
+    }
+    return inbox_thread_index;
+}
+
+static Activity::greater<true, true, true> inbox_compare;
+
+template <bool TS>
+TimeVortexInboxBase<TS>::TimeVortexInboxBase(Params& params) :
+    TimeVortex(),
+    insertOrder(0),
+    max_depth(0),
+    owner(std::this_thread::get_id())
+{
+    if ( TS ) {
+        uint32_t num_threads = params.find<uint32_t>("num_threads", 1);
+        inboxes.resize(num_threads);
+        for ( auto& inbox : inboxes ) {
+            inbox = new Inbox();
+        }
+    }
+}
+
+template <bool TS>
+TimeVortexInboxBase<TS>::~TimeVortexInboxBase()
+{
+    // Activities in TimeVortexInbox all need to be deleted, including
+    // anything still sitting in an inbox
+    if ( TS ) drain();
+    while ( !data.empty() ) {
+        Activity* it = data.top();
+        delete it;
+        data.pop();
+    }
+    for ( auto inbox : inboxes ) {
+        delete inbox;
+    }
+}
+
+template <bool TS>
+void
+TimeVortexInboxBase<TS>::drain()
+{
+    for ( auto inbox : inboxes ) {
+        Activity* activity;
+        while ( inbox->queue.try_remove(activity) ) {
+            activity->setQueueOrder(insertOrder++);
+            data.push(activity);
+            inbox->drained.store(inbox->drained.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+    if ( data.size() > max_depth ) { max_depth = data.size(); }
+}
+
+template <bool TS>
+bool
+TimeVortexInboxBase<TS>::empty()
+{
+    return getCurrentDepth() == 0;
+}
+
+template <bool TS>
+int
+TimeVortexInboxBase<TS>::size()
+{
+    return getCurrentDepth();
+}
+
+template <bool TS>
+uint64_t
+TimeVortexInboxBase<TS>::getCurrentDepth() const
+{
+    uint64_t depth = data.size();
+    for ( auto inbox : inboxes ) {
+        // Read drained first, since inserted is never behind it
+        uint64_t drained = inbox->drained.load(std::memory_order_relaxed);
+        depth += inbox->inserted.load(std::memory_order_acquire) - drained;
+    }
+    return depth;
+}
+
+template <bool TS>
+void
+TimeVortexInboxBase<TS>::insert(Activity* activity)
+{
+    if ( !TS || std::this_thread::get_id() == owner ) {
+        activity->setQueueOrder(insertOrder++);
+        data.push(activity);
+        if ( data.size() > max_depth ) { max_depth = data.size(); }
+        return;
+    }
+
+    // Coming from another thread, put it in that thread's inbox.
+    // Count it first so that the count is never behind what the
+    // owning thread can drain.
+    Inbox* inbox = inboxes[getInboxThreadIndex()];
+    inbox->inserted.store(inbox->inserted.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    inbox->queue.insert(activity);
+}
+
+template <bool TS>
+Activity*
+TimeVortexInboxBase<TS>::pop()
+{
+    if ( TS ) drain();
+    if ( data.empty() ) return nullptr;
+    Activity* ret_val = data.top();
+    data.pop();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexInboxBase<TS>::front()
+{
+    // front() is called by other threads during sync, so look at the
+    // inboxes without draining them
+    Activity* ret = data.empty() ? nullptr : data.top();
+    for ( auto inbox : inboxes ) {
+        inbox->queue.for_each([&ret](Activity* activity) {
+            if ( ret == nullptr || inbox_compare(ret, activity) ) ret = activity;
+        });
+    }
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexInboxBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    //  STL's priority_queue does not support iteration.
+}
+
+class TimeVortexInbox : public TimeVortexInboxBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexInbox,
+        "sst",
+        "timevortex.inbox",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex based on std::priority_queue.  When used with interthread links, other threads insert through lock-free per-thread inboxes.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"num_threads", "Number of threads that may insert into the TimeVortex.  Set by the core.", "1"}
+    )
+
+    TimeVortexInbox(Params& params) : TimeVortexInboxBase<false>(params) {}
+    ~TimeVortexInbox() {}
+    SST_ELI_EXPORT(TimeVortexInbox)
+};
+
+class TimeVortexInbox_ts : public TimeVortexInboxBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexInbox_ts,
+        "sst",
+        "timevortex.inbox.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread safe verion of TimeVortex with lock-free per-thread inboxes.  Do not reference this element directly, just specify sst.timevortex.inbox and this version will be selected when it is needed based on other parameters.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"num_threads", "Number of threads that may insert into the TimeVortex.  Set by the core.", "1"}
+    )
+
+    TimeVortexInbox_ts(Params& params) : TimeVortexInboxBase<true>(params) {}
+    ~TimeVortexInbox_ts() {}
+    SST_ELI_EXPORT(TimeVortexInbox_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,99 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXINBOX_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXINBOX_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/hugePages.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue with lock-free inserts from other threads.
+ *
+ * The priority queue is private to the thread that owns the
+ * TimeVortex.  Other threads (i.e. senders on direct interthread
+ * links) never touch it; instead each thread has its own lock-free
+ * single-producer inbox, and the owning thread moves anything in the
+ * inboxes into the priority queue before each pop().
+ */
+template <bool TS>
+class TimeVortexInboxBase : public TimeVortex
+{
+
+public:
+    TimeVortexInboxBase(Params& params);
+    ~TimeVortexInboxBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override;
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    typedef std::priority_queue<
+        Activity*, std::vector<Activity*, Core::HugePageAllocator<Activity*>>, Activity::greater<true, true, true>>
+        dataType_t;
+
+    struct CACHE_ALIGNED_T Inbox
+    {
+        Core::ThreadSafe::UnboundedSPSCQueue<Activity*> queue;
+        // Written only by the producer
+        std::atomic<uint64_t>                           inserted;
+        // Written only by the owning thread, but read by any thread
+        // asking for the depth
+        CACHE_ALIGNED(std::atomic<uint64_t>, drained);
+
+        Inbox() : inserted(0), drained(0) {}
+    };
+
+    /** Move everything in the inboxes into the priority queue.  Only
+     * called by the owning thread. */
+    void drain();
+
+    // Data, only accessed by the owning thread
+    dataType_t data;
+    uint64_t   insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Thread that created, and therefore pops from, this TimeVortex
+    std::thread::id owner;
+
+    // One inbox per simulation thread, indexed by thread rank
+    std::vector<Inbox*> inboxes;
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXINBOX_H
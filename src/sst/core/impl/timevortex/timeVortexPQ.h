@@ -13,6 +13,7 @@
 #define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXPQ_H
 
 #include "sst/core/eli/elementinfo.h"
+#include "sst/core/hugePages.h"
 #include "sst/core/timeVortex.h"
 
 #include <functional>
@@ -50,7 +51,9 @@ public:
     uint64_t getMaxDepth() const override { return max_depth; }
 
 private:
-    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::greater<true, true, true>> dataType_t;
+    typedef std::priority_queue<
+        Activity*, std::vector<Activity*, Core::HugePageAllocator<Activity*>>, Activity::greater<true, true, true>>
+        dataType_t;
 
     // Data
     dataType_t data;
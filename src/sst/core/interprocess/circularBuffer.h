@@ -14,6 +14,8 @@
 
 #include "sstmutex.h"
 
+#include <cstdio>
+
 namespace SST {
 namespace Core {
 namespace Interprocess {
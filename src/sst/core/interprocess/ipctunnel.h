@@ -13,11 +13,13 @@
 #define SST_CORE_INTERPROCESS_IPCTUNNEL_H
 
 #include "sst/core/interprocess/circularBuffer.h"
+#include "sst/core/warnmacros.h"
 
 #include <cstdio>
 #include <cstring>
 #include <errno.h>
 #include <fcntl.h>
+#include <inttypes.h>
 #include <string>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -57,8 +59,14 @@ public:
      * @param comp_id Component ID of owner
      * @param numBuffers Number of buffers for which we should tunnel
      * @param bufferSize How large each core's buffer should be
+     * @param expectedChildren Number of processes that will attach to the tunnel
+     * @param extraSharedSize Number of bytes to reserve directly after
+     * the ShareDataType region, for shared data whose size is only known
+     * at runtime
      */
-    IPCTunnel(uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1) :
+    IPCTunnel(
+        uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1,
+        size_t extraSharedSize = 0) :
         master(true),
         shmPtr(nullptr),
         fd(-1)
@@ -84,7 +92,7 @@ public:
             exit(1);
         }
 
-        shmSize = calculateShmemSize(numBuffers, bufferSize);
+        shmSize = calculateShmemSize(numBuffers, bufferSize, extraSharedSize);
         if ( ftruncate(fd, shmSize) ) {
             // Not using Output because IPC means Output might not be available
             fprintf(stderr, "Resizing shared file '%s' failed: %s\n", filename.c_str(), strerror(errno));
@@ -108,7 +116,7 @@ public:
         isd->numBuffers       = numBuffers;
 
         /* Construct user's shared-data region */
-        auto shareResult = reserveSpace<ShareDataType>(0);
+        auto shareResult = reserveSpace<ShareDataType>(extraSharedSize);
         isd->offsets[0]  = shareResult.first;
         sharedData       = shareResult.second;
 
@@ -165,7 +173,7 @@ public:
         }
 
         /* Clean up if we're the last to attach */
-        if ( --isd->expectedChildren == 0 ) { shm_unlink(filename.c_str()); }
+        if ( __sync_sub_and_fetch(&isd->expectedChildren, 1) == 0 ) { shm_unlink(filename.c_str()); }
     }
 
     /**
@@ -176,7 +184,7 @@ public:
     /**
      * Shutdown
      */
-    void shutdown(bool all = false)
+    void shutdown(bool UNUSED(all) = false)
     {
         if ( master ) {
             for ( CircBuff_t* cb : circBuffs ) {
@@ -216,21 +224,22 @@ private:
     std::pair<size_t, T*> reserveSpace(size_t extraSpace = 0)
     {
         size_t space = sizeof(T) + extraSpace;
-        if ( ((nextAllocPtr + space) - (uint8_t*)shmPtr) > shmSize ) return std::make_pair<size_t, T*>(0, nullptr);
+        if ( (size_t)((nextAllocPtr + space) - (uint8_t*)shmPtr) > shmSize )
+            return std::make_pair<size_t, T*>(0, nullptr);
         T* ptr = (T*)nextAllocPtr;
         nextAllocPtr += space;
         new (ptr) T(); // Call constructor if need be
         return std::make_pair((uint8_t*)ptr - (uint8_t*)shmPtr, ptr);
     }
 
-    size_t static calculateShmemSize(size_t numBuffers, size_t bufferSize)
+    size_t static calculateShmemSize(size_t numBuffers, size_t bufferSize, size_t extraSharedSize = 0)
     {
         long page_size = sysconf(_SC_PAGESIZE);
 
         /* Count how many pages are needed, at minimum */
         size_t isd    = 1 + ((sizeof(InternalSharedData) + (1 + numBuffers) * sizeof(size_t)) / page_size);
         size_t buffer = 1 + ((sizeof(CircBuff_t) + bufferSize * sizeof(MsgType)) / page_size);
-        size_t shdata = 1 + ((sizeof(ShareDataType) + sizeof(InternalSharedData)) / page_size);
+        size_t shdata = 1 + ((sizeof(ShareDataType) + extraSharedSize + sizeof(InternalSharedData)) / page_size);
 
         /* Alloc 2 extra pages, just in case */
         return (2 + isd + shdata + numBuffers * buffer) * page_size;
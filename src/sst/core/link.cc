@@ -52,6 +52,53 @@ private:
 };
 
 
+/**
+ * Group of events sent with Link::sendBatch().  Takes a single slot
+ * in the TimeVortex and delivers all the events when it fires,
+ * either to the batch handler or one at a time to the regular
+ * handler.  If the regular handler is being profiled, the events go
+ * to it one at a time so the profile tools see each of them.
+ * Deletes itself after delivery.
+ */
+class EventBatch : public Event
+{
+public:
+    EventBatch(std::vector<Event*>& events, uintptr_t batch_handler) : Event(), batch_handler(batch_handler)
+    {
+        this->events.swap(events);
+    }
+    ~EventBatch()
+    {
+        // Only non-empty if the batch was never delivered
+        for ( auto* ev : events ) {
+            delete ev;
+        }
+    }
+
+    void execute(void) override
+    {
+        auto* handler = reinterpret_cast<HandlerBase*>(delivery_info);
+        if ( batch_handler && !(handler && handler->isProfiled()) ) {
+            (*reinterpret_cast<BatchHandlerBase*>(batch_handler))(events);
+        }
+        else {
+            for ( auto* ev : events ) {
+                (*handler)(ev);
+            }
+        }
+        // The handlers now own the events
+        events.clear();
+        delete this;
+    }
+
+private:
+    std::vector<Event*> events;
+    uintptr_t           batch_handler;
+
+    NotSerializable(SST::EventBatch)
+};
+
+
 class LinkSendProfileToolList
 {
 public:
@@ -77,6 +124,7 @@ private:
 Link::Link(LinkId_t tag) :
     send_queue(nullptr),
     delivery_info(0),
+    batch_delivery_info(0),
     defaultTimeBase(0),
     latency(1),
     pair_link(nullptr),
@@ -90,6 +138,7 @@ Link::Link(LinkId_t tag) :
 Link::Link() :
     send_queue(nullptr),
     delivery_info(0),
+    batch_delivery_info(0),
     defaultTimeBase(0),
     latency(1),
     pair_link(nullptr),
@@ -228,6 +277,20 @@ Link::replaceFunctor(Event::HandlerBase* functor)
     pair_link->delivery_info = reinterpret_cast<uintptr_t>(functor);
 }
 
+void
+Link::setBatchFunctor(Event::BatchHandlerBase* functor)
+{
+    if ( UNLIKELY(type == POLL) ) {
+        Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+            CALL_INFO, 1, "Cannot call setBatchFunctor on a Polling Link\n");
+    }
+
+    if ( pair_link->batch_delivery_info ) {
+        delete reinterpret_cast<Event::BatchHandlerBase*>(pair_link->batch_delivery_info);
+    }
+    pair_link->batch_delivery_info = reinterpret_cast<uintptr_t>(functor);
+}
+
 void
 Link::send_impl(SimTime_t delay, Event* event)
 {
@@ -258,6 +321,41 @@ Link::send_impl(SimTime_t delay, Event* event)
     send_queue->insert(event);
 }
 
+void
+Link::sendBatch_impl(SimTime_t delay, std::vector<Event*>& events)
+{
+    if ( events.empty() ) return;
+
+    // Batches can only go straight into a TimeVortex.  Events going
+    // through a sync or to a polling link are sent one at a time.
+    if ( RUN != mode || HANDLER != pair_link->type ) {
+        for ( auto* ev : events ) {
+            send_impl(delay, ev);
+        }
+        events.clear();
+        return;
+    }
+
+    Cycle_t cycle = current_time + delay + latency;
+
+    for ( auto* ev : events ) {
+        // nullptr events are delivered as nullptr, same as send()
+        if ( nullptr == ev ) continue;
+        ev->setDeliveryTime(cycle);
+        ev->setDeliveryInfo(tag, delivery_info);
+#if __SST_DEBUG_EVENT_TRACKING__
+        ev->addSendComponent(comp, ctype, port);
+        ev->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
+#endif
+        if ( profile_tools ) profile_tools->eventSent(ev);
+    }
+
+    EventBatch* batch = new EventBatch(events, batch_delivery_info);
+    batch->setDeliveryTime(cycle);
+    batch->setDeliveryInfo(tag, delivery_info);
+    send_queue->insert(batch);
+}
+
 
 Event*
 Link::recv()
@@ -86,6 +86,15 @@ public:
      */
     void replaceFunctor(Event::HandlerBase* functor);
 
+    /** Set the callback function to be called when a batch of
+     * events sent with sendBatch() is delivered.  If no batch
+     * functor is set, the events in a batch are delivered one at a
+     * time to the functor set with setFunctor().  Any previous batch
+     * handler will be deleted.  Not available for Polling links.
+     * @param functor Functor to call when a batch is delivered
+     */
+    void setBatchFunctor(Event::BatchHandlerBase* functor);
+
     /** Send an event over the link with additional delay. Sends an event
      * over a link with an additional delay specified with a
      * TimeConverter. I.e. the total delay is the link's delay + the
@@ -112,6 +121,37 @@ public:
      */
     inline void send(Event* event) { send_impl(0, event); }
 
+    /** Send a group of events over the link with additional delay.
+     * All of the events will be delivered at the same time and take
+     * up a single entry in the receiver's event queue.  If the other side of the link is on a
+     * different rank, or is a polling link, the events are sent
+     * individually.
+     * @param delay - additional delay
+     * @param tc - time converter to specify units for the additional delay
+     * @param events - the Events to send.  The vector is left empty.
+     */
+    inline void sendBatch(SimTime_t delay, TimeConverter* tc, std::vector<Event*>&& events)
+    {
+        sendBatch_impl(tc->convertToCoreTime(delay), events);
+    }
+
+    /** Send a group of events with additional delay, specified by
+     * the Link's default timebase.  See sendBatch(SimTime_t,
+     * TimeConverter*, std::vector<Event*>&&).
+     * @param delay The additional delay, in units of the default Link timebase
+     * @param events The events to send.  The vector is left empty.
+     */
+    inline void sendBatch(SimTime_t delay, std::vector<Event*>&& events)
+    {
+        sendBatch_impl(delay * defaultTimeBase, events);
+    }
+
+    /** Send a group of events with the Link's default delay.  See
+     * sendBatch(SimTime_t, TimeConverter*, std::vector<Event*>&&).
+     * @param events The events to send.  The vector is left empty.
+     */
+    inline void sendBatch(std::vector<Event*>&& events) { sendBatch_impl(0, events); }
+
 
     /** Retrieve a pending event from the Link. For links which do not
      * have a set event handler, they can be polled with this function.
@@ -214,6 +254,12 @@ protected:
      */
     void send_impl(SimTime_t delay, Event* event);
 
+    /** Send a group of events as a single delivery.  See sendBatch().
+     * @param delay - additional total delay to add
+     * @param events - the Events to send, left empty on return
+     */
+    void sendBatch_impl(SimTime_t delay, std::vector<Event*>& events);
+
     // Since Links are found in pairs, I will keep all the information
     // needed for me to send and deliver an event to the other side of
     // the link.  That means, that I mostly keep my pair's
@@ -235,6 +281,12 @@ protected:
     */
     uintptr_t delivery_info;
 
+    /** Holds a pointer to the batch delivery functor of the other
+      side of the link, or 0 if one hasn't been set.  Stored the same
+      way as delivery_info.
+    */
+    uintptr_t batch_delivery_info;
+
     /** Timebase used if no other timebase is specified. Used to specify
       the units for added delays when sending, such as in
       Link::send(). Often set by the Component::registerClock()
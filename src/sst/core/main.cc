@@ -26,9 +26,11 @@ REENABLE_WARNING
 #include "sst/core/activity.h"
 #include "sst/core/config.h"
 #include "sst/core/configGraph.h"
+#include "sst/core/configGraphCodec.h"
 #include "sst/core/cputimer.h"
 #include "sst/core/exit.h"
 #include "sst/core/factory.h"
+#include "sst/core/hugePages.h"
 #include "sst/core/iouse.h"
 #include "sst/core/link.h"
 #include "sst/core/mempool.h"
@@ -196,24 +198,26 @@ dump_partition(Config& cfg, ConfigGraph* graph, const RankInfo& size)
 }
 
 static void
-do_graph_wireup(ConfigGraph* graph, SST::Simulation_impl* sim, const RankInfo& myRank, SimTime_t min_part)
+do_graph_wireup(
+    ConfigGraph* graph, const ConfigThreadBucket& bucket, SST::Simulation_impl* sim, const RankInfo& myRank,
+    SimTime_t min_part)
 {
 
-    if ( !graph->containsComponentInRank(myRank) ) {
+    if ( bucket.comps.empty() ) {
         g_output.output("WARNING: No components are assigned to rank: %u.%u\n", myRank.rank, myRank.thread);
     }
 
-    sim->performWireUp(*graph, myRank, min_part);
+    sim->performWireUp(*graph, bucket, myRank, min_part);
 }
 
 // Functions to do shared (static) initialization and notificaion for
 // stats engines.  Right now, the StatGroups are per MPI rank and
 // everything else in StatEngine is per partition.
 static void
-do_statengine_static_initialization(ConfigGraph* graph, const RankInfo& myRank)
+do_statengine_static_initialization(ConfigGraph* graph, Config* cfg, const RankInfo& myRank)
 {
     if ( myRank.thread != 0 ) return;
-    StatisticProcessingEngine::static_setup(graph);
+    StatisticProcessingEngine::static_setup(graph, cfg->async_stat_output());
 }
 
 static void
@@ -238,9 +242,11 @@ do_statengine_initialization(ConfigGraph* graph, SST::Simulation_impl* sim, cons
 }
 
 static void
-do_link_preparation(ConfigGraph* graph, SST::Simulation_impl* sim, const RankInfo& myRank, SimTime_t min_part)
+do_link_preparation(
+    ConfigGraph* graph, const ConfigThreadBucket& bucket, SST::Simulation_impl* sim, const RankInfo& myRank,
+    SimTime_t min_part)
 {
-    sim->prepareLinks(*graph, myRank, min_part);
+    sim->prepareLinks(*graph, bucket, myRank, min_part);
 }
 
 // Returns the extension, or an empty string if there was no extension
@@ -316,6 +322,12 @@ typedef struct
     ConfigGraph* graph;
     SimTime_t    min_part;
 
+    // Components and links this thread builds
+    ConfigThreadBucket* bucket;
+    // Latencies between the threads of this rank, shared by all
+    // threads
+    const ConfigThreadLatencies* latencies;
+
     // Time / stats information
     double      build_time;
     double      run_time;
@@ -324,6 +336,9 @@ typedef struct
     uint64_t    current_tv_depth;
     uint64_t    sync_data_size;
 
+    // Costs measured for --output-partition-costs
+    PartitionCosts partition_costs;
+
 } SimThreadInfo_t;
 
 static void
@@ -344,7 +359,7 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
 
     barrier.wait();
 
-    sim->processGraphInfo(*info.graph, info.myRank, info.min_part);
+    sim->processGraphInfo(*info.latencies, info.myRank, info.min_part);
 
     barrier.wait();
 
@@ -353,7 +368,7 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     barrier.wait();
 
     // Perform the wireup.
-    if ( tid == 0 ) { do_statengine_static_initialization(info.graph, info.myRank); }
+    if ( tid == 0 ) { do_statengine_static_initialization(info.graph, info.config, info.myRank); }
     barrier.wait();
 
     do_statengine_initialization(info.graph, sim, info.myRank);
@@ -371,16 +386,21 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     // time of adding this code, the difference in delete times was
     // 3-5 minutes versuses less than a second.
     for ( uint32_t i = 0; i < info.world_size.thread; ++i ) {
-        if ( i == info.myRank.thread ) { do_link_preparation(info.graph, sim, info.myRank, info.min_part); }
+        if ( i == info.myRank.thread ) {
+            do_link_preparation(info.graph, *info.bucket, sim, info.myRank, info.min_part);
+        }
         barrier.wait();
     }
 #else
-    do_link_preparation(info.graph, sim, info.myRank, info.min_part);
+    do_link_preparation(info.graph, *info.bucket, sim, info.myRank, info.min_part);
 #endif
     barrier.wait();
 
     // Create all the simulation components
-    do_graph_wireup(info.graph, sim, info.myRank, info.min_part);
+    do_graph_wireup(info.graph, *info.bucket, sim, info.myRank, info.min_part);
+
+    // The bucket points into the graph, so is done with too
+    *info.bucket = ConfigThreadBucket();
     barrier.wait();
 
     if ( tid == 0 ) { delete info.graph; }
@@ -546,6 +566,8 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     // Put in info about sync memory usage
     info.sync_data_size = sim->getSyncQueueDataSize();
 
+    if ( !info.config->outputPartitionCosts().empty() ) sim->getPartitionCosts(info.partition_costs);
+
     delete sim;
 }
 
@@ -699,6 +721,10 @@ main(int argc, char* argv[])
         if ( graph->checkForStructuralErrors() ) {
             g_output.fatal(CALL_INFO, 1, "Structure errors found in the ConfigGraph.\n");
         }
+
+        // Latencies are resolved and the links connected, so the data
+        // only needed for building the graph can go
+        if ( cfg.compact_graph() ) { graph->compact(); }
     }
 
     double end_graph_gen = sst_get_cpu_time();
@@ -746,6 +772,17 @@ main(int argc, char* argv[])
     if ( !cfg.parallel_load() ) {
         // Normal partitioning
 
+        // Replace the static weights with the costs measured in an
+        // earlier run
+        if ( !cfg.partition_costs().empty() && myRank.rank == 0 ) {
+            PartitionCosts costs;
+            if ( !costs.read(cfg.partition_costs()) ) {
+                g_output.fatal(
+                    CALL_INFO, 1, "ERROR: Unable to read partition costs from %s\n", cfg.partition_costs().c_str());
+            }
+            graph->applyPartitionCosts(costs);
+        }
+
         // If this is a serial job, just use the single partitioner,
         // but the same code path
         if ( world_size.rank == 1 && world_size.thread == 1 ) cfg.partitioner_ = "sst.single";
@@ -881,13 +918,13 @@ main(int argc, char* argv[])
                 ConfigGraph* your_graph = graph->splitGraph(my_ranks, your_ranks);
                 int          dest       = *your_ranks.begin();
                 Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
+                Core::sendConfigGraph(dest, 0, *your_graph);
                 your_ranks.clear();
                 delete your_graph;
             }
             else {
                 Comms::recv(MPI_ANY_SOURCE, 0, my_ranks);
-                Comms::recv(MPI_ANY_SOURCE, 0, *graph);
+                Core::recvConfigGraph(MPI_ANY_SOURCE, 0, *graph);
             }
 
             while ( my_ranks.size() != 1 ) {
@@ -906,7 +943,7 @@ main(int argc, char* argv[])
                 uint32_t dest = *your_ranks.begin();
 
                 Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
+                Core::sendConfigGraph(dest, 0, *your_graph);
                 your_ranks.clear();
                 delete your_graph;
             }
@@ -927,10 +964,19 @@ main(int argc, char* argv[])
     Simulation_impl::factory    = factory;
     Simulation_impl::sim_output = g_output;
     Simulation_impl::resizeBarriers(world_size.thread);
+    // Set before any mempool arena or TimeVortex is allocated
+    Core::HugePages::setMode(cfg.huge_pages());
+    Core::ThreadSafe::WaitPolicy::setMode(cfg.barrier_wait_policy());
 #ifdef USE_MEMPOOL
     MemPoolAccessor::initializeGlobalData(world_size.thread, cfg.cache_align_mempools());
 #endif
 
+    // Sort the graph by thread and find the latencies between threads
+    // once here, rather than having every thread walk the whole graph
+    // to find its own part
+    std::vector<ConfigThreadBucket> buckets   = graph->bucketByThread(myRank.rank, world_size.thread);
+    ConfigThreadLatencies           latencies = graph->getThreadLatencies(myRank.rank, world_size.thread);
+
     std::vector<std::thread>     threads(world_size.thread);
     std::vector<SimThreadInfo_t> threadInfo(world_size.thread);
     for ( uint32_t i = 0; i < world_size.thread; i++ ) {
@@ -940,6 +986,8 @@ main(int argc, char* argv[])
         threadInfo[i].config        = &cfg;
         threadInfo[i].graph         = graph;
         threadInfo[i].min_part      = min_part;
+        threadInfo[i].bucket        = &buckets[i];
+        threadInfo[i].latencies     = &latencies;
     }
 
     double end_serial_build = sst_get_cpu_time();
@@ -974,6 +1022,31 @@ main(int argc, char* argv[])
         threadInfo[0].sync_data_size += threadInfo[i].sync_data_size;
     }
 
+    // Collect the measured partition costs on rank 0 and write them
+    // out
+    if ( !cfg.outputPartitionCosts().empty() ) {
+        PartitionCosts& costs = threadInfo[0].partition_costs;
+        for ( uint32_t i = 1; i < world_size.thread; i++ ) {
+            costs.merge(threadInfo[i].partition_costs);
+        }
+#ifdef SST_CONFIG_HAVE_MPI
+        if ( myRank.rank == 0 ) {
+            for ( uint32_t i = 1; i < world_size.rank; i++ ) {
+                PartitionCosts rank_costs;
+                Comms::recv(i, 0, rank_costs);
+                costs.merge(rank_costs);
+            }
+        }
+        else {
+            Comms::send(0, 0, costs);
+        }
+#endif
+        if ( myRank.rank == 0 && !costs.write(cfg.outputPartitionCosts()) ) {
+            g_output.output(
+                "WARNING: Unable to write partition costs to %s\n", cfg.outputPartitionCosts().c_str());
+        }
+    }
+
     double build_time = (end_serial_build - start) + threadInfo[0].build_time;
     double run_time   = threadInfo[0].run_time;
     double total_time = total_end_time - start;
@@ -1070,6 +1143,21 @@ main(int argc, char* argv[])
         g_output.output(
             "  Max Sync data size:              %s\n", global_max_sync_data_size_ua.toStringBestSI().c_str());
         g_output.output("  Global Sync data size:           %s\n", global_sync_data_size_ua.toStringBestSI().c_str());
+
+        std::vector<Core::MemPoolAccessor::SizeClassUsage> size_classes;
+        Core::MemPoolAccessor::getSizeClassUsage(size_classes);
+        if ( !size_classes.empty() ) {
+            g_output.output("\n");
+            g_output.output("Rank 0 Mempool Size Classes:\n");
+            for ( auto& sc : size_classes ) {
+                ua_buffer = format_string("%" PRIu64 "B", sc.bytes);
+                UnitAlgebra bytes_ua(ua_buffer);
+                g_output.output(
+                    "  <= %6zu B: %s in %zu arenas, %" PRId64 " active, %" PRId64 " freed by other threads\n",
+                    sc.element_size, bytes_ua.toStringBestSI().c_str(), sc.num_arenas, sc.active_entries,
+                    sc.remote_frees);
+            }
+        }
         g_output.output("------------------------------------------------------------\n");
         g_output.output("\n");
         g_output.output("\n");
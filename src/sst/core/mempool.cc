@@ -13,13 +13,15 @@
 
 #include "sst/core/mempool.h"
 
+#include "sst/core/hugePages.h"
 #include "sst/core/mempoolAccessor.h"
 #include "sst/core/output.h"
 #include "sst/core/threadsafe.h"
 
+#include <algorithm>
+#include <atomic>
 #include <list>
 #include <sstream>
-#include <sys/mman.h>
 #include <sys/time.h>
 #include <vector>
 
@@ -32,63 +34,55 @@ namespace Core {
 // Mempool classes optimized to minimize cross thread interferance     //
 ///////////////////////////////////////////////////////////////////////
 
-/**
-   Class to hold full overflow lists for transfering to other threads.
-   This class will require mutexes because it is accessed by multiple
-   threads, but the accesser are fast (just swapping vector contents)
-   and don't happen often (only when an overflow list reaches max size
-   or a mempool runs out of items on its freelist.
+/*
+   Items are served from a fixed set of size classes: every 16 bytes up
+   to 1 KB, then four classes per power of two.  Each thread has its own
+   pool for each size class it uses and is the only thread that
+   allocates from it.
+
+   Every item is preceded by an 8 byte header holding the requested
+   size in the low 48 bits and the thread that owns the item in the top
+   16 bits.  The header is set to 0 when the item is deleted, which is
+   how double deletes and undeleted items are found.
+
+   An item deleted by its owner goes back on the owner's freelist.  An
+   item deleted on another thread (e.g. an event sent across a thread
+   boundary) is pushed onto a lock-free stack in the owner's pool, and
+   the owner takes the whole stack back when its freelist runs out.
+   Memory therefore always returns to the thread that allocated it.
  */
-class OverflowFreeList
-{
-
-    struct OverflowList
-    {
-        size_t                          size;
-        std::vector<std::vector<void*>> lists;
 
-        OverflowList(size_t size, std::vector<void*>& list) : size(size)
-        {
-            lists.emplace_back();
-            lists.back().swap(list);
-        }
-    };
+static const size_t small_class_step  = 16;
+static const size_t small_class_limit = 1024;
+static const size_t num_small_classes = small_class_limit / small_class_step;
+// Four classes per power of two above small_class_limit, up to 2^48
+static const size_t num_size_classes  = num_small_classes + 4 * (48 - 10);
 
-    std::vector<OverflowList> store;
+static const unsigned header_owner_shift = 48;
+static const uint64_t header_size_mask   = (1ull << header_owner_shift) - 1;
 
-    ThreadSafe::Spinlock lock;
+static_assert((1ull << 10) == small_class_limit, "small_class_limit must be 2^10");
 
-public:
-    void insert(size_t size, std::vector<void*>& list)
-    {
-        std::lock_guard<ThreadSafe::Spinlock> slock(lock);
-        bool                                  found = false;
-        for ( auto& x : store ) {
-            if ( x.size == size ) {
-                found = true;
-                x.lists.emplace_back();
-                x.lists.back().swap(list);
-            }
-        }
-        if ( !found ) { store.emplace_back(size, list); }
-    }
+/** Return the size class that serves items of size bytes */
+inline size_t
+sizeClass(size_t size)
+{
+    if ( size <= small_class_limit ) return (size + small_class_step - 1) / small_class_step - 1;
+    // size is in (2^p, 2^(p+1)], which is split into four classes
+    unsigned p    = 63 - __builtin_clzll(size - 1);
+    size_t   step = (size_t)1 << (p - 2);
+    return num_small_classes + (p - 10) * 4 + (size - 1 - ((size_t)1 << p)) / step;
+}
 
-    bool remove(size_t size, std::vector<void*>& list)
-    {
-        std::lock_guard<ThreadSafe::Spinlock> slock(lock);
-        bool                                  found = false;
-        for ( auto& x : store ) {
-            if ( x.size == size ) {
-                if ( !x.lists.empty() ) {
-                    list.swap(x.lists.back());
-                    x.lists.pop_back();
-                    found = true;
-                }
-            }
-        }
-        return found;
-    }
-};
+/** Return the largest item size served by a size class */
+inline size_t
+classSize(size_t cls)
+{
+    if ( cls < num_small_classes ) return (cls + 1) * small_class_step;
+    cls -= num_small_classes;
+    size_t p = 10 + cls / 4;
+    return ((size_t)1 << p) + (cls % 4 + 1) * ((size_t)1 << (p - 2));
+}
 
 
 // Controls whether or not the mempools cache align their entries
@@ -96,105 +90,78 @@ static bool memPoolCacheAlign = false;
 
 
 /**
- * Simple Memory Pool class.  The class instance is only ever accessed
- * by a single thread.  Only have to mutex when putting things in the
- * overflow store.
+ * Memory pool for one size class on one thread.  Only the owning
+ * thread allocates from the pool or frees to its freelist.  Other
+ * threads return items through remoteFree(), which is lock-free.
  */
-class MemPoolNoMutex
+class SizeClassPool
 {
     std::vector<void*> freelist;
-    std::vector<void*> overflow;
-
-    static OverflowFreeList shared_overflow;
 
 public:
     /** Create a new Memory Pool.
-     * @param elementSize - Size of each Element
-     * @param initialSize - Size of the memory pool (in bytes)
+     * @param elementSize - Size of each Element, including the header
+     * @param initialSize - Size of each arena (in bytes)
      */
-    MemPoolNoMutex(size_t elementSize, size_t initialSize = (2 << 20)) :
+    SizeClassPool(size_t elementSize, size_t initialSize = (2 << 20)) :
         numAlloc(0),
         numFree(0),
         elemSize(elementSize),
-        arenaSize(initialSize),
-        max_freelist_size(0)
+        remote_head(nullptr),
+        remote_frees(0)
     {
         if ( memPoolCacheAlign ) {
             // Round up to next multiple of 64 to ensure no events are
             // on the same cache line
-            size_t remainder = (elemSize + 8) % 64;
-            allocSize        = (remainder == 0) ? (elemSize + 8) : ((elemSize + 8) + 64 - remainder);
+            size_t remainder = elemSize % 64;
+            allocSize        = (remainder == 0) ? elemSize : (elemSize + 64 - remainder);
         }
         else {
-            allocSize = elemSize + 8;
+            allocSize = elemSize;
         }
-        max_overflow_size = arenaSize / allocSize;
+        // Large classes still get a useful number of items per arena.
+        // Arenas fill whole huge pages if those are in use.
+        arenaSize = HugePages::mappedSize(std::max(initialSize, allocSize * 16));
 
         // Won't alloc until we need to
         // allocPool();
     }
 
-    ~MemPoolNoMutex()
-    {
-        for ( std::list<uint8_t*>::iterator i = arenas.begin(); i != arenas.end(); ++i ) {
-            ::free(*i);
-        }
-    }
-
-    /** Allocate a new element from the memory pool */
+    /** Allocate a new element from the memory pool.  Owning thread only */
     inline void* malloc()
     {
-        // We will service these out of the freelist first.  If
-        // we don't have any in the freelist, then check the overflow.
-        // If there is nothing there, we need to check with the shared
-        // overflow to see if there is data there we can take.  If all
-        // that fails, then alloc a new arena.
-
+        // Serve from the freelist.  If it is empty, take back the items
+        // other threads have freed, and only if there are none of those
+        // alloc a new arena.
         numAlloc++;
 
-        // Check freelist
-        if ( !freelist.empty() ) {
-            void* ret = freelist.back();
-            freelist.pop_back();
-            return ret;
-        }
-
-        // Check overflow.
-        if ( !overflow.empty() ) {
-            void* ret = overflow.back();
-            overflow.pop_back();
-            return ret;
+        if ( freelist.empty() ) {
+            reclaimRemote();
+            if ( freelist.empty() && !allocPool() ) return nullptr;
         }
-
-        // Need to check the shared_overflow
-        shared_overflow.remove(elemSize, overflow);
-        if ( !overflow.empty() ) {
-            void* ret = overflow.back();
-            overflow.pop_back();
-            return ret;
-        }
-
-        // Need to allocate a new arena
-        bool ok = allocPool();
-        if ( !ok ) return nullptr;
         void* ret = freelist.back();
         freelist.pop_back();
         return ret;
     }
 
-    /** Return an element to the memory pool */
+    /** Return an element to the memory pool.  Owning thread only */
     inline void free(void* ptr)
     {
         numFree++;
-        // Goes in freelist if we aren't at max capacity.  Otherwise
-        // goes in overflow.
-        if ( freelist.size() >= max_freelist_size ) {
-            overflow.push_back(ptr);
-            if ( overflow.size() == max_overflow_size ) { shared_overflow.insert(elemSize, overflow); }
-        }
-        else {
-            freelist.push_back(ptr);
-        }
+        freelist.push_back(ptr);
+    }
+
+    /** Return an element to the memory pool from a thread other than
+     * the owner.  The link to the next item is stored in the first word
+     * after the header, which is no longer in use. */
+    inline void remoteFree(void* ptr)
+    {
+        void** next = (void**)((uint64_t*)ptr + 1);
+        void*  head = remote_head.load(std::memory_order_relaxed);
+        do {
+            *next = head;
+        } while ( !remote_head.compare_exchange_weak(head, ptr, std::memory_order_release, std::memory_order_relaxed) );
+        remote_frees.fetch_add(1, std::memory_order_relaxed);
     }
 
     /**
@@ -205,17 +172,16 @@ public:
     {
         uint64_t bytes_in_arenas    = arenas.size() * arenaSize;
         uint64_t bytes_in_free_list = freelist.capacity() * sizeof(void*);
-        uint64_t bytes_in_overflow  = overflow.capacity() * sizeof(void*);
-        return bytes_in_arenas + bytes_in_free_list + bytes_in_overflow;
+        return bytes_in_arenas + bytes_in_free_list;
     }
 
-    // uint64_t getUndeletedEntries() { return numAlloc - numFree; }
     int64_t getNumAllocatedEntries() { return numAlloc; }
-    int64_t getNumFreedEntries() { return numFree; }
+    int64_t getNumFreedEntries() { return numFree + getNumRemoteFrees(); }
+    int64_t getNumRemoteFrees() { return remote_frees.load(std::memory_order_relaxed); }
 
     /** Counter:  Number of times elements have been allocated */
     int64_t numAlloc;
-    /** Counter:  Number times elements have been freed */
+    /** Counter:  Number times elements have been freed by the owning thread */
     int64_t numFree;
 
     size_t getArenaSize() const { return arenaSize; }
@@ -226,76 +192,82 @@ public:
     const std::list<uint8_t*>& getArenas() { return arenas; }
 
 private:
+    // Move everything other threads have freed onto the freelist
+    void reclaimRemote()
+    {
+        void* item = remote_head.exchange(nullptr, std::memory_order_acquire);
+        while ( item ) {
+            freelist.push_back(item);
+            item = *(void**)((uint64_t*)item + 1);
+        }
+    }
+
     // allocPool will only ever be called by one thread, no need for locking
     // version that will cache align each memory chunk for an event
     bool allocPool()
     {
-        uint8_t* newPool = (uint8_t*)mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
-        if ( MAP_FAILED == newPool ) { return false; }
-        std::memset(newPool, 0, arenaSize);
+        // Pools are only used by the thread that owns them, so mapping
+        // the arena here places it on the owner's NUMA node
+        uint8_t* newPool = (uint8_t*)HugePages::map(arenaSize);
+        if ( nullptr == newPool ) { return false; }
         arenas.push_back(newPool);
         size_t nelem = arenaSize / allocSize;
-        for ( size_t i = 0; i < nelem; i++ ) {
-            uint64_t* ptr = (uint64_t*)(newPool + (allocSize * i));
+        // Push in reverse so items are handed out in address order
+        for ( size_t i = nelem; i > 0; i-- ) {
+            uint64_t* ptr = (uint64_t*)(newPool + (allocSize * (i - 1)));
             freelist.push_back(ptr);
         }
-        max_freelist_size += nelem;
         return true;
     }
 
     size_t elemSize;
     size_t arenaSize;
-    size_t max_freelist_size;
-    size_t max_overflow_size;
     size_t allocSize;
 
     std::list<uint8_t*> arenas;
-};
-
 
-OverflowFreeList MemPoolNoMutex::shared_overflow;
+    // Written by other threads, so kept off the cache lines the owner
+    // uses for allocation
+    alignas(64) std::atomic<void*> remote_head;
+    std::atomic<int64_t> remote_frees;
+};
 
 
 ///////////////////////////////////////////////////////////////////////
 // Classes to support MemPoolItem and MemPoolAccessor
 ///////////////////////////////////////////////////////////////////////
 
-struct PoolInfo_t
+/**
+ * The pools of one thread, indexed by size class.  The table has a
+ * fixed size so that other threads can find a pool to return items to
+ * while the owner is adding pools.
+ */
+struct ThreadPools_t
 {
-    size_t          size;
-    MemPoolNoMutex* pool;
-
-    PoolInfo_t(size_t size, Core::MemPoolNoMutex* pool) : size(size), pool(pool) {}
+    SizeClassPool* pools[num_size_classes] = {};
 };
 
 
 // This is a vector where each thread has one entry.  Using a vector
 // so that the memory will be cleaned up.  There won't be a chance to
 // call delete[] if we use an array with new.
-static std::vector<std::vector<PoolInfo_t>> memPoolThreadVector;
+static std::vector<ThreadPools_t> memPoolThreadVector;
 
 // My local thread number
-thread_local int                      thread_num = -1;
-thread_local std::vector<PoolInfo_t>* myPools;
+thread_local int            thread_num = -1;
+thread_local ThreadPools_t* myPools;
 
 
-inline MemPoolNoMutex*
+inline SizeClassPool*
 getMemPool(std::size_t size) noexcept
 {
-    MemPoolNoMutex* pool = nullptr;
-
-    for ( auto& x : *myPools ) {
-        if ( x.size == size ) {
-            pool = x.pool;
-            break;
-        }
-    }
+    size_t         cls  = sizeClass(size);
+    SizeClassPool* pool = myPools->pools[cls];
 
     if ( nullptr == pool ) {
-        /* Still can't find it, alloc a new one */
-        // pool = new Core::MemPoolNoMutex(size + sizeof(PoolData_t));
-        pool = new Core::MemPoolNoMutex(size + sizeof(uint64_t*));
-        myPools->emplace_back(size, pool);
+        /* First use of this class on this thread, alloc a new one */
+        pool                = new Core::SizeClassPool(classSize(cls) + sizeof(uint64_t*));
+        myPools->pools[cls] = pool;
     }
     return pool;
 }
@@ -350,23 +322,45 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     int64_t alloced = 0;
     int64_t freed   = 0;
     for ( auto&& pool_group : memPoolThreadVector ) {
-        for ( auto&& entry : pool_group ) {
-            bytes += entry.pool->getBytesMemUsed();
-            alloced += entry.pool->getNumAllocatedEntries();
-            freed += entry.pool->getNumFreedEntries();
+        for ( SizeClassPool* pool : pool_group.pools ) {
+            if ( !pool ) continue;
+            bytes += pool->getBytesMemUsed();
+            alloced += pool->getNumAllocatedEntries();
+            freed += pool->getNumFreedEntries();
         }
     }
     active_entries = alloced - freed;
 }
 
+void
+MemPoolAccessor::getSizeClassUsage(std::vector<SizeClassUsage>& usage)
+{
+    usage.clear();
+    for ( size_t cls = 0; cls < num_size_classes; ++cls ) {
+        SizeClassUsage entry = { classSize(cls), 0, 0, 0, 0 };
+        bool           used  = false;
+        for ( auto&& pool_group : memPoolThreadVector ) {
+            SizeClassPool* pool = pool_group.pools[cls];
+            if ( !pool ) continue;
+            used = true;
+            entry.num_arenas += pool->getNumArenas();
+            entry.bytes += pool->getBytesMemUsed();
+            entry.active_entries += pool->getNumAllocatedEntries() - pool->getNumFreedEntries();
+            entry.remote_frees += pool->getNumRemoteFrees();
+        }
+        if ( used ) usage.push_back(entry);
+    }
+}
+
 void
 MemPoolAccessor::printUndeletedMemPoolItems(const std::string& header, Output& out)
 {
     for ( auto&& pool_group : memPoolThreadVector ) {
-        for ( auto&& entry : pool_group ) {
-            const std::list<uint8_t*>& arenas    = entry.pool->getArenas();
-            size_t                     arenaSize = entry.pool->getArenaSize();
-            size_t                     allocSize = entry.pool->getAllocSize();
+        for ( SizeClassPool* pool : pool_group.pools ) {
+            if ( !pool ) continue;
+            const std::list<uint8_t*>& arenas    = pool->getArenas();
+            size_t                     arenaSize = pool->getArenaSize();
+            size_t                     allocSize = pool->getAllocSize();
             size_t                     nelem     = arenaSize / allocSize;
             for ( auto iter = arenas.begin(); iter != arenas.end(); ++iter ) {
                 for ( size_t j = 0; j < nelem; j++ ) {
@@ -387,16 +381,16 @@ MemPoolItem::operator new(std::size_t size) noexcept
 {
     /* 1) Find memory pool
      * 2) Alloc item from pool
-     * 3) Append PoolID to item, increment pointer
+     * 3) Write size and owning thread to the header, increment pointer
      */
-    MemPoolNoMutex* pool = getMemPool(size);
+    SizeClassPool* pool = getMemPool(size);
 
     uint64_t* ptr = (uint64_t*)pool->malloc();
     if ( !ptr ) {
         fprintf(stderr, "Memory Pool failed to allocate a new object.  Error: %s\n", strerror(errno));
         return nullptr;
     }
-    *ptr = size;
+    *ptr = size | ((uint64_t)thread_num << header_owner_shift);
     return (void*)(ptr + 1);
 }
 
@@ -405,13 +399,14 @@ void
 MemPoolItem::operator delete(void* ptr)
 {
     /* 1) Decrement pointer
-     * 2) Determine Pool Pointer
-     * 2b) Set Pool_id field to 0 to allow tracking
-     * 3) Return to local pool
+     * 2) Determine size class and owning thread from the header
+     * 2b) Set header to 0 to allow tracking
+     * 3) Return to local pool, or to the owner's pool if the item came
+     *    from another thread
      */
-    uint64_t* ptr8 = ((uint64_t*)ptr) - 1;
-    uint64_t  size = *ptr8;
-    if ( *ptr8 == 0 ) {
+    uint64_t* ptr8   = ((uint64_t*)ptr) - 1;
+    uint64_t  header = *ptr8;
+    if ( header == 0 ) {
         // This item has already been deleted, error
         Output::getDefaultObject().fatal(
             CALL_INFO, 1, "ERROR: Double deletion of mempool item detected: %s",
@@ -419,9 +414,13 @@ MemPoolItem::operator delete(void* ptr)
     }
     *ptr8 = 0;
 
-    // find the pool
-    MemPoolNoMutex* pool = getMemPool(size);
-    pool->free(ptr8);
+    size_t size  = header & header_size_mask;
+    int    owner = header >> header_owner_shift;
+
+    if ( owner == thread_num ) { getMemPool(size)->free(ptr8); }
+    else {
+        memPoolThreadVector[owner].pools[sizeClass(size)]->remoteFree(ptr8);
+    }
 }
 
 
@@ -458,6 +457,13 @@ MemPoolAccessor::getBytesMemUsedBy(size_t UNUSED(size))
 }
 
 
+void
+MemPoolAccessor::getSizeClassUsage(std::vector<SizeClassUsage>& usage)
+{
+    usage.clear();
+}
+
+
 void
 MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
 {
@@ -12,6 +12,8 @@
 #ifndef SST_CORE_MEMPOOL_ACCESSOR_H
 #define SST_CORE_MEMPOOL_ACCESSOR_H
 
+#include <cstdint>
+#include <vector>
 
 namespace SST {
 
@@ -42,6 +44,21 @@ public:
     // aren't enabled, then nothing will be counted.
     static void getMemPoolUsage(int64_t& bytes, int64_t& active_entries);
 
+    // Usage of one mempool size class, summed over the threads of the
+    // rank
+    struct SizeClassUsage
+    {
+        size_t   element_size;   // Largest item size served by the class
+        size_t   num_arenas;     // Number of arenas allocated
+        uint64_t bytes;          // Approximate bytes used
+        int64_t  active_entries; // Items allocated and not yet freed
+        int64_t  remote_frees;   // Items freed by a thread other than the one that allocated them
+    };
+
+    // Gets the usage of each size class that has been used on the
+    // rank.  If mempools aren't enabled, usage will be empty.
+    static void getSizeClassUsage(std::vector<SizeClassUsage>& usage);
+
     // Initialize the global mempool data structures
     static void initializeGlobalData(int num_threads, bool cache_align = false);
 
@@ -311,6 +311,9 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
     PyDict_SetItem(dict, SST_ConvertToPythonString("exit-after"), SST_ConvertToPythonLong(cfg->exit_after()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("partitioner"), SST_ConvertToPythonString(cfg->partitioner().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("partition-costs"),
+        SST_ConvertToPythonString(cfg->partition_costs().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("heartbeat-period"), SST_ConvertToPythonString(cfg->heartbeatPeriod().c_str()));
     PyDict_SetItem(
@@ -339,10 +342,26 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
     PyDict_SetItem(dict, SST_ConvertToPythonString("timebase"), SST_ConvertToPythonString(cfg->timeBase().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("parallel-load"), SST_ConvertToPythonString(cfg->parallel_load_str().c_str()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("compact-graph"), SST_ConvertToPythonBool(cfg->compact_graph()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("time-vortex"), SST_ConvertToPythonString(cfg->timeVortex().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("interthread-links"), SST_ConvertToPythonBool(cfg->interthread_links()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("clock-batching"), SST_ConvertToPythonBool(cfg->clock_batching()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("async-stat-output"), SST_ConvertToPythonBool(cfg->async_stat_output()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("adaptive-rank-sync"), SST_ConvertToPythonBool(cfg->adaptive_rank_sync()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("nonblocking-rank-sync"),
+        SST_ConvertToPythonBool(cfg->nonblocking_rank_sync()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("shmem-rank-sync"), SST_ConvertToPythonBool(cfg->shmem_rank_sync()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("huge-pages"), SST_ConvertToPythonString(cfg->huge_pages().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("barrier-wait-policy"),
+        SST_ConvertToPythonString(cfg->barrier_wait_policy().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("debug-file"), SST_ConvertToPythonString(cfg->debugFile().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("lib-path"), SST_ConvertToPythonString(cfg->libpath().c_str()));
     PyDict_SetItem(
@@ -354,6 +373,9 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         SST_ConvertToPythonString(cfg->enabledProfiling().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("profiling-output"), SST_ConvertToPythonString(cfg->profilingOutput().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("output-partition-costs"),
+        SST_ConvertToPythonString(cfg->outputPartitionCosts().c_str()));
 
     // Advanced options - debug
     PyDict_SetItem(dict, SST_ConvertToPythonString("run-mode"), SST_ConvertToPythonString(cfg->runMode_str().c_str()));
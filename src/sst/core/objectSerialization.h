@@ -26,17 +26,12 @@ serialize(dataType& data)
 {
     SST::Core::Serialization::serializer ser;
 
-    ser.start_sizing();
-    ser& data;
-
-    size_t size = ser.size();
-
     std::vector<char> buffer;
-    buffer.resize(size);
 
-    ser.start_packing(buffer.data(), size);
+    ser.start_packing(buffer);
     ser& data;
 
+    buffer.resize(ser.size());
     return buffer;
 }
 
@@ -38,6 +38,8 @@ class SSTModelDescription;
 
 namespace Core {
 class ConfigGraphOutput;
+class ConfigGraphReader;
+class ConfigGraphWriter;
 } // namespace Core
 
 /**
@@ -848,6 +850,8 @@ private:
     friend class SST::ConfigGraph;
     friend class SST::ConfigComponent;
     friend class SST::Core::ConfigGraphOutput;
+    friend class SST::Core::ConfigGraphReader;
+    friend class SST::Core::ConfigGraphWriter;
     friend class SST::SSTModelDescription;
 
     /**
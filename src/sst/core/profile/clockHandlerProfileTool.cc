@@ -13,6 +13,7 @@
 
 #include "sst/core/profile/clockHandlerProfileTool.h"
 
+#include "sst/core/configGraph.h"
 #include "sst/core/output.h"
 #include "sst/core/sst_types.h"
 
@@ -93,6 +94,37 @@ ClockHandlerProfileToolCount::outputData(FILE* fp)
 }
 
 
+ClockHandlerProfileToolCost::ClockHandlerProfileToolCost(const std::string& name, Params& params) :
+    ClockHandlerProfileTool(name, params)
+{}
+
+uintptr_t
+ClockHandlerProfileToolCost::registerHandler(const HandlerMetaData& mdata)
+{
+    const ClockHandlerMetaData& data = dynamic_cast<const ClockHandlerMetaData&>(mdata);
+    return reinterpret_cast<uintptr_t>(&times_[data.comp_name]);
+}
+
+void
+ClockHandlerProfileToolCost::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "Name, handler time (s)\n");
+    for ( auto& x : times_ ) {
+        fprintf(fp, "%s, %lf\n", x.first.c_str(), ((double)x.second) / 1000000000.0);
+    }
+}
+
+void
+ClockHandlerProfileToolCost::addPartitionCosts(PartitionCosts& costs)
+{
+    // Time is charged to the component, including the time of its
+    // subcomponents
+    for ( auto& x : times_ )
+        costs.component_time[x.first.substr(0, x.first.find(":"))] += x.second;
+}
+
+
 template <typename T>
 ClockHandlerProfileToolTime<T>::ClockHandlerProfileToolTime(const std::string& name, Params& params) :
     ClockHandlerProfileTool(name, params)
@@ -23,6 +23,8 @@
 
 namespace SST {
 
+class PartitionCosts;
+
 namespace Profile {
 
 
@@ -115,6 +117,49 @@ private:
     std::map<std::string, clock_data_t> times_;
 };
 
+/**
+   Profile tool that measures the time spent in the clock handlers of
+   each component, for use in partitioning a later run of the same
+   configuration (see --output-partition-costs and --partition-costs)
+ */
+class ClockHandlerProfileToolCost : public ClockHandlerProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        ClockHandlerProfileToolCost,
+        SST::Profile::ClockHandlerProfileTool,
+        "sst",
+        "profile.handler.clock.cost",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will measure the clock handler time of each component, for use as partitioning costs.  Ignores "
+        "level."
+    )
+
+    ClockHandlerProfileToolCost(const std::string& name, Params& params);
+
+    virtual ~ClockHandlerProfileToolCost() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = std::chrono::steady_clock::now(); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        auto total_time = std::chrono::steady_clock::now() - start_time_;
+        *reinterpret_cast<uint64_t*>(key) += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+    }
+
+    void outputData(FILE* fp) override;
+
+    /** Add the measured costs to costs */
+    void addPartitionCosts(PartitionCosts& costs);
+
+private:
+    std::chrono::steady_clock::time_point start_time_;
+    // Time in ns, keyed by component
+    std::map<std::string, uint64_t>       times_;
+};
+
 } // namespace Profile
 } // namespace SST
 
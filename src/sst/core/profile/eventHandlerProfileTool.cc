@@ -13,6 +13,7 @@
 
 #include "sst/core/profile/eventHandlerProfileTool.h"
 
+#include "sst/core/configGraph.h"
 #include "sst/core/output.h"
 #include "sst/core/sst_types.h"
 
@@ -112,6 +113,46 @@ EventHandlerProfileToolCount::outputData(FILE* fp)
 }
 
 
+EventHandlerProfileToolCost::EventHandlerProfileToolCost(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params)
+{
+    // Only receives carry a cost
+    profile_sends_    = false;
+    profile_receives_ = true;
+}
+
+uintptr_t
+EventHandlerProfileToolCost::registerHandler(const HandlerMetaData& mdata)
+{
+    const EventHandlerMetaData& data = dynamic_cast<const EventHandlerMetaData&>(mdata);
+    return reinterpret_cast<uintptr_t>(&costs_[data.comp_name + " " + data.port_name]);
+}
+
+void
+EventHandlerProfileToolCost::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "Name, port, recv count, recv time (s)\n");
+    for ( auto& x : costs_ ) {
+        size_t index = x.first.rfind(' ');
+        fprintf(
+            fp, "%s, %s, %" PRIu64 ", %lf\n", x.first.substr(0, index).c_str(), x.first.substr(index + 1).c_str(),
+            x.second.recv_count, ((double)x.second.recv_time) / 1000000000.0);
+    }
+}
+
+void
+EventHandlerProfileToolCost::addPartitionCosts(PartitionCosts& costs)
+{
+    for ( auto& x : costs_ ) {
+        // Time is charged to the component, including the time of
+        // its subcomponents
+        costs.component_time[x.first.substr(0, x.first.find_first_of(": "))] += x.second.recv_time;
+        costs.link_events[x.first] += x.second.recv_count;
+    }
+}
+
+
 template <typename T>
 EventHandlerProfileToolTime<T>::EventHandlerProfileToolTime(const std::string& name, Params& params) :
     EventHandlerProfileTool(name, params)
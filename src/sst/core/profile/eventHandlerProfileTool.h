@@ -23,6 +23,8 @@
 
 namespace SST {
 
+class PartitionCosts;
+
 namespace Profile {
 
 
@@ -139,6 +141,60 @@ private:
     std::map<std::string, event_data_t> times_;
 };
 
+/**
+   Profile tool that measures the time spent in the handlers of each
+   component and the number of events received on each port, for use
+   in partitioning a later run of the same configuration (see
+   --output-partition-costs and --partition-costs)
+ */
+class EventHandlerProfileToolCost : public EventHandlerProfileTool
+{
+    struct event_data_t
+    {
+        uint64_t recv_time;
+        uint64_t recv_count;
+
+        event_data_t() : recv_time(0), recv_count(0) {}
+    };
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolCost,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.cost",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will measure the handler time of each component and the events received on each port, for use "
+        "as partitioning costs.  Ignores level and track_ports."
+    )
+
+    EventHandlerProfileToolCost(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolCost() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = std::chrono::steady_clock::now(); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        auto          total_time = std::chrono::steady_clock::now() - start_time_;
+        event_data_t* entry      = reinterpret_cast<event_data_t*>(key);
+        entry->recv_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->recv_count++;
+    }
+
+    void outputData(FILE* fp) override;
+
+    /** Add the measured costs to costs */
+    void addPartitionCosts(PartitionCosts& costs);
+
+private:
+    std::chrono::steady_clock::time_point start_time_;
+    // Keyed by "component port"
+    std::map<std::string, event_data_t>   costs_;
+};
+
 } // namespace Profile
 } // namespace SST
 
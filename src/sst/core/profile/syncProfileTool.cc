@@ -56,6 +56,42 @@ SyncProfileToolTime<T>::outputData(FILE* fp)
 }
 
 
+SyncProfileToolBarrierWait::SyncProfileToolBarrierWait(const std::string& name, Params& params) :
+    SyncProfileTool(name, params)
+{}
+
+void
+SyncProfileToolBarrierWait::syncBarrierWait(const char* barrier, uint64_t wait_time)
+{
+    BarrierWaits& entry = waits[barrier];
+    entry.count++;
+    entry.total += wait_time;
+    if ( wait_time > entry.max ) entry.max = wait_time;
+    entry.bins[wait_time == 0 ? 0 : 64 - __builtin_clzll(wait_time)]++;
+}
+
+void
+SyncProfileToolBarrierWait::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    for ( auto& x : waits ) {
+        const BarrierWaits& entry = x.second;
+        fprintf(fp, "  Barrier %s\n", x.first);
+        fprintf(fp, "    Wait Count = %" PRIu64 "\n", entry.count);
+        fprintf(fp, "    Total Wait Time = %lfs\n", (double)entry.total / 1000000000.0);
+        fprintf(fp, "    Average Wait Time = %" PRIu64 "ns\n", entry.total / entry.count);
+        fprintf(fp, "    Max Wait Time = %" PRIu64 "ns\n", entry.max);
+        fprintf(fp, "    Wait Time Histogram:\n");
+        for ( int i = 0; i < 65; ++i ) {
+            if ( entry.bins[i] == 0 ) continue;
+            uint64_t low  = i == 0 ? 0 : 1ull << (i - 1);
+            uint64_t high = i == 0 ? 0 : low + (low - 1);
+            fprintf(fp, "      %" PRIu64 "-%" PRIu64 "ns = %" PRIu64 "\n", low, high, entry.bins[i]);
+        }
+    }
+}
+
+
 class SyncProfileToolTimeHighResolution : public SyncProfileToolTime<std::chrono::high_resolution_clock>
 {
 public:
@@ -18,6 +18,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <chrono>
+#include <cstring>
 #include <map>
 
 namespace SST {
@@ -40,6 +41,14 @@ public:
 
     virtual void syncManagerStart() {}
     virtual void syncManagerEnd() {}
+
+    /**
+       Called with the time (in nanoseconds) this thread spent waiting
+       at one of the sync barriers.  Only called on tools that return
+       true from recordsBarrierWaits().
+     */
+    virtual void syncBarrierWait(const char* UNUSED(barrier), uint64_t UNUSED(wait_time)) {}
+    virtual bool recordsBarrierWaits() const { return false; }
 };
 
 
@@ -102,6 +111,50 @@ private:
     typename T::time_point start_time_;
 };
 
+/**
+   Profile tool that keeps a histogram of the time this thread spends
+   waiting at each sync barrier.  Comparing the histograms of the
+   threads shows load imbalance between them.
+ */
+class SyncProfileToolBarrierWait : public SyncProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        SyncProfileToolBarrierWait,
+        SST::Profile::SyncProfileTool,
+        "sst",
+        "profile.sync.barrier_wait",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will keep a histogram of the time spent waiting at each sync barrier"
+    )
+
+    SyncProfileToolBarrierWait(const std::string& name, Params& params);
+
+    virtual ~SyncProfileToolBarrierWait() {}
+
+    void syncBarrierWait(const char* barrier, uint64_t wait_time) override;
+    bool recordsBarrierWaits() const override { return true; }
+
+    void outputData(FILE* fp) override;
+
+private:
+    struct BarrierWaits
+    {
+        uint64_t count = 0;
+        uint64_t total = 0;
+        uint64_t max   = 0;
+        // Bin 0 counts waits of 0ns, bin i counts waits of [2^(i-1), 2^i) ns
+        uint64_t bins[65] = {};
+    };
+
+    struct NameLess
+    {
+        bool operator()(const char* a, const char* b) const { return strcmp(a, b) < 0; }
+    };
+
+    std::map<const char*, BarrierWaits, NameLess> waits;
+};
+
 } // namespace Profile
 } // namespace SST
 
@@ -15,6 +15,7 @@
 #include "sst/core/serialization/serialize_buffer_accessor.h"
 
 #include <string>
+#include <vector>
 
 namespace SST {
 namespace Core {
@@ -24,13 +25,46 @@ namespace pvt {
 class ser_packer : public ser_buffer_accessor
 {
 public:
+    ser_packer() : ser_buffer_accessor(), growable_(nullptr), offset_(0) {}
+
     template <class T>
     void pack(T& t)
     {
-        T* buf = ser_buffer_accessor::next<T>();
+        T* buf = next<T>();
         *buf   = t;
     }
 
+    /**
+     * Pack into a fixed size buffer.  Packing past the end of the
+     * buffer throws ser_buffer_overrun.
+     */
+    void init(void* buffer, size_t size)
+    {
+        growable_ = nullptr;
+        ser_buffer_accessor::init(buffer, size);
+    }
+
+    /**
+     * Pack into a buffer that is resized as needed, starting at
+     * offset.  The vector is never shrunk, so reusing it for later
+     * packs avoids reallocating.  Pointers into the buffer are only
+     * valid until the next call that packs data.
+     */
+    void init(std::vector<char>& buffer, size_t offset);
+
+    template <class T>
+    T* next()
+    {
+        if ( growable_ && size_ + sizeof(T) > max_size_ ) grow(sizeof(T));
+        return ser_buffer_accessor::next<T>();
+    }
+
+    char* next_str(size_t size)
+    {
+        if ( growable_ && size_ + size > max_size_ ) grow(size);
+        return ser_buffer_accessor::next_str(size);
+    }
+
     /**
      * @brief pack_buffer
      * @param buf  Must be non-null
@@ -39,6 +73,12 @@ public:
     void pack_buffer(void* buf, int size);
 
     void pack_string(std::string& str);
+
+private:
+    void grow(size_t needed);
+
+    std::vector<char>* growable_;
+    size_t             offset_;
 };
 
 } // namespace pvt
@@ -35,6 +35,28 @@ ser_unpacker::unpack_buffer(void* buf, int size)
     ::memcpy(*bufptr, charstr, size);
 }
 
+void
+ser_packer::init(std::vector<char>& buffer, size_t offset)
+{
+    if ( buffer.size() < offset ) buffer.resize(offset);
+    growable_ = &buffer;
+    offset_   = offset;
+    ser_buffer_accessor::init(buffer.data() + offset, buffer.size() - offset);
+}
+
+void
+ser_packer::grow(size_t needed)
+{
+    // Double the buffer, or more if a single item needs it
+    size_t new_size = growable_->size() * 2;
+    if ( new_size < offset_ + size_ + needed ) new_size = offset_ + size_ + needed;
+    growable_->resize(new_size);
+
+    bufstart_ = growable_->data() + offset_;
+    bufptr_   = bufstart_ + size_;
+    max_size_ = new_size - offset_;
+}
+
 void
 ser_packer::pack_buffer(void* buf, int size)
 {
@@ -170,6 +170,20 @@ public:
         mode_ = PACK;
     }
 
+    /**
+     * Pack directly into buffer, growing it as needed, so the data
+     * does not need a separate sizing pass.  Packed data starts at
+     * offset, leaving room for a header.  After packing, size()
+     * returns the number of bytes packed after offset; the buffer
+     * itself may be larger.  Reusing the same buffer keeps its
+     * allocation from one pack to the next.
+     */
+    void start_packing(std::vector<char>& buffer, size_t offset = 0)
+    {
+        packer_.init(buffer, offset);
+        mode_ = PACK;
+    }
+
     void start_sizing()
     {
         sizer_.reset();
@@ -28,6 +28,7 @@
 #include "sst/core/profile/syncProfileTool.h"
 #include "sst/core/shared/sharedObject.h"
 #include "sst/core/statapi/statengine.h"
+#include "sst/core/statapi/statuniquecount.h"
 #include "sst/core/stopAction.h"
 #include "sst/core/stringize.h"
 #include "sst/core/sync/syncManager.h"
@@ -97,6 +98,10 @@ Simulation_impl::~Simulation_impl()
     // in the queue, as well as the Sync, Exit and Clock objects.
     delete timeVortex;
 
+    // Any clocks still scheduled in the ClockBatch were deleted along
+    // with their Ticks in the timeVortex
+    delete clockBatch;
+
     // Delete all the components
     // for ( CompMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it ) {
     // delete it->second;
@@ -146,6 +151,7 @@ Simulation_impl::createSimulation(Config* config, RankInfo my_rank, RankInfo num
     instanceVec.resize(num_ranks.thread);
     instanceVec[my_rank.thread] = instance;
     instance->intializeProfileTools(config->enabledProfiling());
+    if ( !config->outputPartitionCosts().empty() ) instance->initializePartitionCostTools();
     return instance;
 }
 
@@ -160,6 +166,7 @@ Simulation_impl::shutdown()
 Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ranks) :
     Simulation(),
     timeVortex(nullptr),
+    clockBatch(nullptr),
     interThreadMinLatency(MAX_SIMTIME_T),
     endSim(false),
     untimed_phase(0),
@@ -183,10 +190,15 @@ Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ran
     output_directory = cfg->output_directory();
     Params p;
     // params get passed twice - both the params and a ctor argument
-    direct_interthread = cfg->interthread_links();
+    direct_interthread    = cfg->interthread_links();
+    adaptive_rank_sync    = cfg->adaptive_rank_sync();
+    nonblocking_rank_sync = cfg->nonblocking_rank_sync();
+    shmem_rank_sync       = cfg->shmem_rank_sync();
     std::string timevortex_type(cfg->timeVortex());
     if ( direct_interthread && num_ranks.thread > 1 ) timevortex_type = timevortex_type + ".ts";
+    p.insert("num_threads", std::to_string(num_ranks.thread));
     timeVortex = factory->Create<TimeVortex>(timevortex_type, p);
+    if ( cfg->clock_batching() ) clockBatch = new ClockBatch();
     if ( my_rank.thread == 0 ) { m_exit = new Exit(num_ranks.thread, num_ranks.rank == 1); }
 
     if ( cfg->heartbeatPeriod() != "" && my_rank.thread == 0 ) {
@@ -240,61 +252,25 @@ Simulation_impl::getLocalMinimumNextActivityTime()
 }
 
 void
-Simulation_impl::processGraphInfo(ConfigGraph& graph, const RankInfo& UNUSED(myRank), SimTime_t min_part)
+Simulation_impl::processGraphInfo(
+    const ConfigThreadLatencies& latencies, const RankInfo& UNUSED(myRank), SimTime_t min_part)
 {
     // Set minPartTC (only thread 0 will do this)
     Simulation_impl::minPart = min_part;
     if ( my_rank.thread == 0 ) { minPartTC = minPartToTC(min_part); }
 
-    // Get the minimum latencies for links between the various threads
+    // Get the minimum latencies for links between this thread and
+    // each of the others.  The matrix for the whole rank was computed
+    // once before the threads started.
     interThreadLatencies.resize(num_ranks.thread);
-    for ( size_t i = 0; i < interThreadLatencies.size(); i++ ) {
-        interThreadLatencies[i] = MAX_SIMTIME_T;
+    for ( uint32_t i = 0; i < num_ranks.thread; i++ ) {
+        interThreadLatencies[i] = latencies.get(my_rank.thread, i);
     }
 
-    interThreadMinLatency      = MAX_SIMTIME_T;
-    int num_cross_thread_links = 0;
-    if ( num_ranks.thread > 1 ) {
-        // Need to determine the lookahead for the thread synchronization
-        ConfigComponentMap_t comps = graph.getComponentMap();
-        ConfigLinkMap_t      links = graph.getLinkMap();
-        // Find the minimum latency across a partition
-        for ( auto iter = links.begin(); iter != links.end(); ++iter ) {
-            ConfigLink* clink = *iter;
-            RankInfo    rank[2];
-            rank[0] = comps[COMPONENT_ID_MASK(clink->component[0])]->rank;
-            rank[1] = comps[COMPONENT_ID_MASK(clink->component[1])]->rank;
-            // We only care about links that are on my rank, but
-            // different threads
-
-            // Neither endpoint is on my rank
-            if ( rank[0].rank != my_rank.rank && rank[1].rank != my_rank.rank ) continue;
-            // Rank and thread are the same
-            if ( rank[0] == rank[1] ) continue;
-            // Different ranks, so doesn't affect interthread dependencies
-            if ( rank[0].rank != rank[1].rank ) continue;
-
-            // At this point, we know that both endpoints are on this
-            // rank, but on different threads.  Therefore, they
-            // contribute to the interThreadMinLatency.
-            num_cross_thread_links++;
-            if ( clink->getMinLatency() < interThreadMinLatency ) { interThreadMinLatency = clink->getMinLatency(); }
-
-            // Now check only those latencies that directly impact this
-            // thread.  Keep track of minimum latency for each other
-            // thread separately
-            if ( rank[0].thread == my_rank.thread ) {
-                if ( clink->getMinLatency() < interThreadLatencies[rank[1].thread] ) {
-                    interThreadLatencies[rank[1].thread] = clink->getMinLatency();
-                }
-            }
-            else if ( rank[1].thread == my_rank.thread ) {
-                if ( clink->getMinLatency() < interThreadLatencies[rank[0].thread] ) {
-                    interThreadLatencies[rank[0].thread] = clink->getMinLatency();
-                }
-            }
-        }
-    }
+    // Need to determine the lookahead for the thread synchronization
+    interThreadMinLatency      = latencies.min_latency;
+    int num_cross_thread_links = latencies.num_links;
+
     // Create the SyncManager for this rank.  It gets created even if
     // we are single rank/single thread because it also manages the
     // Exit and Heartbeat actions.
@@ -327,33 +303,29 @@ Simulation_impl::initializeStatisticEngine(ConfigGraph& graph)
 
 
 int
-Simulation_impl::prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTime_t UNUSED(min_part))
+Simulation_impl::prepareLinks(
+    ConfigGraph& graph, const ConfigThreadBucket& bucket, const RankInfo& myRank, SimTime_t UNUSED(min_part))
 {
-    // First, go through all the components that are in this rank and
-    // create the ComponentInfo object for it
-    // Now, build all the components
-    for ( ConfigComponentMap_t::const_iterator iter = graph.comps.begin(); iter != graph.comps.end(); ++iter ) {
-        ConfigComponent* ccomp = *iter;
-        if ( ccomp->rank == myRank ) {
-            compInfoMap.insert(new ComponentInfo(ccomp, ccomp->name, nullptr, new LinkMap()));
-        }
+    // The bucket only holds the components and links this thread is
+    // responsible for, so all the threads can do this at the same time
+    // without looking at the rest of the graph.
+
+    // First, go through all the components that are in this thread
+    // and create the ComponentInfo object for it
+    for ( ConfigComponent* ccomp : bucket.comps ) {
+        compInfoMap.insert(new ComponentInfo(ccomp, ccomp->name, nullptr, new LinkMap()));
     }
 
     // We will go through all the links and create LinkPairs for each
     // link.  We will also create a LinkMap for each component and put
     // them into a map with ComponentID as the key.
-    for ( ConfigLinkMap_t::const_iterator iter = graph.links.begin(); iter != graph.links.end(); ++iter ) {
-        ConfigLink* clink = *iter;
-        RankInfo    rank[2];
+    for ( ConfigLink* clink : bucket.links ) {
+        RankInfo rank[2];
         rank[0] = graph.comps[COMPONENT_ID_MASK(clink->component[0])]->rank;
         rank[1] = graph.comps[COMPONENT_ID_MASK(clink->component[1])]->rank;
 
-        if ( rank[0] != myRank && rank[1] != myRank ) {
-            // Nothing to be done
-            continue;
-        }
         // Same rank, same thread
-        else if ( rank[0] == rank[1] ) {
+        if ( rank[0] == rank[1] ) {
             // Check to see if this is loopback link
             if ( clink->component[0] == clink->component[1] && clink->port[0] == clink->port[1] ) {
                 // This is a loopback, so there is only one link
@@ -471,29 +443,27 @@ Simulation_impl::prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTim
 
 
 int
-Simulation_impl::performWireUp(ConfigGraph& graph, const RankInfo& myRank, SimTime_t UNUSED(min_part))
+Simulation_impl::performWireUp(
+    ConfigGraph& UNUSED(graph), const ConfigThreadBucket& bucket, const RankInfo& UNUSED(myRank),
+    SimTime_t UNUSED(min_part))
 {
     // Params objects should now start verifying parameters
     Params::enableVerify();
 
 
     // Now, build all the components
-    for ( auto iter = graph.comps.begin(); iter != graph.comps.end(); ++iter ) {
-        ConfigComponent* ccomp = *iter;
-
-        if ( ccomp->rank == myRank ) {
-            Component* tmp;
+    for ( ConfigComponent* ccomp : bucket.comps ) {
+        Component* tmp;
 
-            // Check to make sure there are any entries in the component's LinkMap
-            ComponentInfo* cinfo = compInfoMap.getByID(ccomp->id);
-            if ( !cinfo->hasLinks() ) {
-                printf("WARNING: Building component \"%s\" with no links assigned.\n", ccomp->name.c_str());
-            }
+        // Check to make sure there are any entries in the component's LinkMap
+        ComponentInfo* cinfo = compInfoMap.getByID(ccomp->id);
+        if ( !cinfo->hasLinks() ) {
+            printf("WARNING: Building component \"%s\" with no links assigned.\n", ccomp->name.c_str());
+        }
 
-            tmp = createComponent(ccomp->id, ccomp->type, ccomp->params);
+        tmp = createComponent(ccomp->id, ccomp->type, ccomp->params);
 
-            cinfo->setComponent(tmp);
-        }
+        cinfo->setComponent(tmp);
     } // end for all vertex
     // Done with vertices, delete them;
     /*  TODO:  THREADING:  Clear only once everybody is done.
@@ -740,6 +710,10 @@ Simulation_impl::run()
 
     run_phase_total_time = sst_get_cpu_time() - run_phase_start_time;
 
+    for ( auto const& entry : clockMap ) {
+        sim_output.verbose(CALL_INFO, 2, 0, "%s\n", entry.second->toString().c_str());
+    }
+
     // If we have no links that are cut by a partition, we need to do
     // a final check to get the right simulated time.
     if ( minPart == MAX_SIMTIME_T && num_ranks.rank > 1 && my_rank.thread == 0 ) {
@@ -838,6 +812,11 @@ Simulation_impl::finish()
 
     finishBarrier.wait();
 
+    // Merge the unique count sketches shared across threads and ranks
+    // before the final statistic output
+    if ( my_rank.thread == 0 ) { Statistics::HyperLogLog::mergeGlobal(); }
+    finishBarrier.wait();
+
     // Tell the Statistics Engine that the simulation is ending
     stat_engine.endOfSimulation();
 }
@@ -857,6 +836,10 @@ Simulation_impl::printStatus(bool fullStatus)
 
     if ( fullStatus ) {
         timeVortex->print(out);
+        out.output("---- Clocks: ----\n");
+        for ( auto const& entry : clockMap ) {
+            out.output("%s\n", entry.second->toString().c_str());
+        }
         out.output("---- Components: ----\n");
         for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
             (*iter)->getComponent()->printStatus(out);
@@ -989,6 +972,15 @@ Simulation_impl::insertActivity(SimTime_t time, Activity* ev)
     timeVortex->insert(ev);
 }
 
+void
+Simulation_impl::insertClock(SimTime_t time, Clock* clock)
+{
+    if ( clockBatch ) { clockBatch->insert(time, clock); }
+    else {
+        insertActivity(time, clock);
+    }
+}
+
 uint64_t
 Simulation_impl::getTimeVortexMaxDepth() const
 {
@@ -1233,12 +1225,43 @@ Simulation_impl::intializeProfileTools(const std::string& config)
 #endif
 }
 
+void
+Simulation_impl::initializePartitionCostTools()
+{
+    // Both tools go on the built-in points alongside any tools the
+    // user enabled
+    const std::pair<std::string, std::string> tools[] = {
+        { "event", "sst.profile.handler.event.cost" },
+        { "clock", "sst.profile.handler.clock.cost" },
+    };
+    for ( auto& x : tools ) {
+        std::string name = "partition-costs." + x.first;
+        Params      params;
+        profile_tools[name] =
+            Factory::getFactory()->CreateProfileTool<SST::Profile::ProfileTool>(x.second, name, params);
+        profiler_map[x.first].push_back(name);
+        partition_cost_tools.insert(name);
+    }
+}
+
+void
+Simulation_impl::getPartitionCosts(PartitionCosts& costs)
+{
+    for ( auto& name : partition_cost_tools ) {
+        SST::Profile::ProfileTool* tool = profile_tools[name];
+        if ( auto* event_tool = dynamic_cast<SST::Profile::EventHandlerProfileToolCost*>(tool) )
+            event_tool->addPartitionCosts(costs);
+        else if ( auto* clock_tool = dynamic_cast<SST::Profile::ClockHandlerProfileToolCost*>(tool) )
+            clock_tool->addPartitionCosts(costs);
+    }
+}
+
 void
 Simulation_impl::printProfilingInfo(FILE* fp)
 {
     // If no profile tools are installed, return without doing
     // anything
-    if ( profile_tools.size() == 0 ) return;
+    if ( profile_tools.size() == partition_cost_tools.size() ) return;
 
     // Print out a header if printing to stdout
     if ( fp == stdout && my_rank.rank == 0 && my_rank.thread == 0 ) {
@@ -1251,6 +1274,7 @@ Simulation_impl::printProfilingInfo(FILE* fp)
     fprintf(fp, "Rank = %" PRIu32 ", thread = %" PRIu32 ":\n", my_rank.rank, my_rank.thread);
 
     for ( auto tool : profile_tools ) {
+        if ( partition_cost_tools.count(tool.first) ) continue;
         fprintf(fp, "\n");
         tool.second->outputData(fp);
     }
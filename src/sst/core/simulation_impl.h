@@ -28,6 +28,7 @@
 #include <atomic>
 #include <cstdio>
 #include <iostream>
+#include <set>
 #include <signal.h>
 #include <thread>
 #include <unordered_map>
@@ -44,12 +45,15 @@ class Activity;
 class Component;
 class Config;
 class ConfigGraph;
+struct ConfigThreadBucket;
+struct ConfigThreadLatencies;
 class Exit;
 class Factory;
 class SimulatorHeartbeat;
 class Link;
 class LinkMap;
 class Params;
+class PartitionCosts;
 class SharedRegionManager;
 class SimulatorHeartbeat;
 class SyncBase;
@@ -156,6 +160,11 @@ public:
     /** Insert an activity to fire at a specified time */
     void insertActivity(SimTime_t time, Activity* ev);
 
+    /** Schedule a clock to fire at a specified time.  Goes through
+     * the ClockBatch if clock batching is enabled, otherwise straight
+     * into the TimeVortex */
+    void insertClock(SimTime_t time, Clock* clock);
+
     /** Return the exit event */
     Exit* getExit() const { return m_exit; }
 
@@ -164,11 +173,12 @@ public:
     /** Processes the ConfigGraph to pull out any need information
      * about relationships among the threads
      */
-    void processGraphInfo(ConfigGraph& graph, const RankInfo& myRank, SimTime_t min_part);
+    void processGraphInfo(const ConfigThreadLatencies& latencies, const RankInfo& myRank, SimTime_t min_part);
 
     int  initializeStatisticEngine(ConfigGraph& graph);
-    int  prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTime_t min_part);
-    int  performWireUp(ConfigGraph& graph, const RankInfo& myRank, SimTime_t min_part);
+    int  prepareLinks(ConfigGraph& graph, const ConfigThreadBucket& bucket, const RankInfo& myRank, SimTime_t min_part);
+    int  performWireUp(
+         ConfigGraph& graph, const ConfigThreadBucket& bucket, const RankInfo& myRank, SimTime_t min_part);
     void exchangeLinkInfo();
 
     /** Set cycle count, which, if reached, will cause the simulation to halt. */
@@ -196,6 +206,9 @@ public:
 
     void printProfilingInfo(FILE* fp);
 
+    /** Add the costs measured for --output-partition-costs to costs */
+    void getPartitionCosts(PartitionCosts& costs);
+
     void printPerformanceInfo();
 
     /** Register a OneShot event to be called after a time delay
@@ -327,6 +340,9 @@ public:
     static Core::ThreadSafe::Spinlock cross_thread_lock;
     static std::map<LinkId_t, Link*>  cross_thread_links;
     bool                              direct_interthread;
+    bool                              adaptive_rank_sync;
+    bool                              nonblocking_rank_sync;
+    bool                              shmem_rank_sync;
 
     Component* createComponent(ComponentId_t id, const std::string& name, Params& params);
 
@@ -350,6 +366,7 @@ public:
     friend class SyncManager;
 
     TimeVortex*             timeVortex;
+    ClockBatch*             clockBatch;
     TimeConverter*          threadMinPartTC;
     Activity*               current_activity;
     static SimTime_t        minPart;
@@ -382,10 +399,14 @@ public:
     /** Performance Tracking Information **/
 
     void intializeProfileTools(const std::string& config);
+    void initializePartitionCostTools();
 
     std::map<std::string, SST::Profile::ProfileTool*> profile_tools;
     // Maps the component profile points to profiler names
     std::map<std::string, std::vector<std::string>>   profiler_map;
+    // Tools installed for --output-partition-costs.  They are in
+    // profile_tools, but are left out of the profiling output.
+    std::set<std::string>                             partition_cost_tools;
 
     template <typename T>
     std::vector<T*> getProfileTool(std::string point)
@@ -152,6 +152,9 @@ public:
         }
     }
 
+    /** Returns true if profile tools can be attached to this handler */
+    bool isProfiled() const { return profile_tools != nullptr; }
+
     /**
        Get the ID for this Handler.  Handler IDs are only used for
        profiling, so if this function is called, it will also set
@@ -173,8 +176,22 @@ class SSTHandlerBase : public SSTHandlerBaseProfile
     virtual returnT operator_impl(argT) = 0;
 
 public:
+    /**
+       Non-virtual entry point for the handler.  Callers that invoke
+       large numbers of handlers can store the thunk next to the
+       handler pointer and call thunk(handler, arg) directly.
+     */
+    typedef returnT (*Thunk_t)(SSTHandlerBase*, argT);
+
     ~SSTHandlerBase() {}
 
+    /**
+       Returns the direct call thunk for this handler, or nullptr if
+       the handler must be called through operator() (i.e. it has
+       profile tools attached)
+     */
+    Thunk_t getThunk() const { return profile_tools ? nullptr : thunk; }
+
     inline returnT operator()(argT arg)
     {
         if ( profile_tools ) {
@@ -187,6 +204,9 @@ public:
         }
         return operator_impl(arg);
     }
+
+protected:
+    Thunk_t thunk = nullptr;
 };
 
 
@@ -197,8 +217,12 @@ class SSTHandlerBase<void, argT> : public SSTHandlerBaseProfile
     virtual void operator_impl(argT) = 0;
 
 public:
+    typedef void (*Thunk_t)(SSTHandlerBase*, argT);
+
     ~SSTHandlerBase() {}
 
+    Thunk_t getThunk() const { return profile_tools ? nullptr : thunk; }
+
     inline void operator()(argT arg)
     {
         if ( profile_tools ) {
@@ -209,6 +233,9 @@ public:
         }
         operator_impl(arg);
     }
+
+protected:
+    Thunk_t thunk = nullptr;
 };
 
 
@@ -235,9 +262,18 @@ public:
         object(object),
         member(member),
         data(data)
-    {}
+    {
+        this->thunk = &SSTHandler::call;
+    }
 
     returnT operator_impl(argT arg) override { return (object->*member)(arg, data); }
+
+private:
+    static returnT call(SSTHandlerBase<returnT, argT>* handler, argT arg)
+    {
+        SSTHandler* self = static_cast<SSTHandler*>(handler);
+        return (self->object->*(self->member))(arg, self->data);
+    }
 };
 
 
@@ -258,9 +294,18 @@ public:
      * @param member - Member function to call as the handler
      */
     SSTHandler(classT* const object, PtrMember member) : SSTHandlerBase<returnT, argT>(), member(member), object(object)
-    {}
+    {
+        this->thunk = &SSTHandler::call;
+    }
 
     returnT operator_impl(argT arg) override { return (object->*member)(arg); }
+
+private:
+    static returnT call(SSTHandlerBase<returnT, argT>* handler, argT arg)
+    {
+        SSTHandler* self = static_cast<SSTHandler*>(handler);
+        return (self->object->*(self->member))(arg);
+    }
 };
 
 
@@ -17,6 +17,7 @@
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/stataccumulator.h"
 #include "sst/core/statapi/stathistogram.h"
+#include "sst/core/statapi/statloghistogram.h"
 #include "sst/core/statapi/statnull.h"
 #include "sst/core/statapi/statoutputcsv.h"
 #include "sst/core/statapi/statoutputjson.h"
@@ -217,6 +218,13 @@ SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(LogHistogramStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(LogHistogramStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(LogHistogramStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(LogHistogramStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(LogHistogramStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(LogHistogramStatistic, double);
+
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int64_t);
@@ -224,5 +232,12 @@ SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, double);
+
 } // namespace Statistics
 } // namespace SST
@@ -21,6 +21,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <string>
+#include <vector>
 
 namespace SST {
 class BaseComponent;
@@ -319,6 +320,19 @@ struct StatisticCollector<T, true>
             addData_impl(data);
         }
     }
+
+    /**
+     * @brief addData_impl_batch Add an array of values in one call
+     *        By default, this just calls the addData function once per value
+     * @param values The values to add
+     * @param count  The number of values in the array
+     */
+    virtual void addData_impl_batch(const T* values, size_t count)
+    {
+        for ( size_t i = 0; i < count; ++i ) {
+            addData_impl(values[i]);
+        }
+    }
 };
 
 template <class... Args>
@@ -396,6 +410,21 @@ public:
         }
     }
 
+    /** Add an array of values to the Statistic
+     * This will call the addData_impl_batch() routine in the derived
+     * Statistic, which may bin the whole array in a single pass.  Only
+     * available for Statistics of fundamental types.
+     */
+    void addDataBatch(const T* values, size_t count)
+    {
+        if ( isEnabled() && count > 0 ) {
+            this->addData_impl_batch(values, count);
+            incrementCollectionCount(count);
+        }
+    }
+
+    void addDataBatch(const std::vector<T>& values) { addDataBatch(values.data(), values.size()); }
+
     static fieldType_t fieldId() { return StatisticFieldType<T>::id(); }
 
 protected:
@@ -37,11 +37,16 @@ StatisticProcessingEngine::StatisticProcessingEngine() : m_output(Output::getDef
 
 
 void
-StatisticProcessingEngine::static_setup(ConfigGraph* graph)
+StatisticProcessingEngine::static_setup(ConfigGraph* graph, bool async_output)
 {
     // Outputs are per MPI rank, so have to be static data
     for ( auto& cfg : graph->getStatOutputs() ) {
-        m_statOutputs.push_back(createStatisticOutput(cfg));
+        StatisticOutput* so = createStatisticOutput(cfg);
+        if ( async_output ) {
+            StatisticFieldsOutput* fo = dynamic_cast<StatisticFieldsOutput*>(so);
+            if ( fo ) fo->startAsyncOutput();
+        }
+        m_statOutputs.push_back(so);
     }
 }
 
@@ -57,6 +62,8 @@ void
 StatisticProcessingEngine::stat_outputs_simulation_end()
 {
     for ( auto& so : m_statOutputs ) {
+        StatisticFieldsOutput* fo = dynamic_cast<StatisticFieldsOutput*>(so);
+        if ( fo ) fo->stopAsyncOutput();
         so->endOfSimulation();
     }
 }
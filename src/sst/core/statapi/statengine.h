@@ -83,8 +83,9 @@ public:
 
     /** Called to setup the StatOutputs, which are shared across all
        the StatEngines on the same MPI rank.
+       @param async_output Write output on a background thread
      */
-    static void static_setup(ConfigGraph* graph);
+    static void static_setup(ConfigGraph* graph, bool async_output);
 
     /** Called to nofiy StatOutputs that simulation has started
      */
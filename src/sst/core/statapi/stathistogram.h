@@ -17,6 +17,9 @@
 #include "sst/core/statapi/statoutput.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace SST {
 namespace Statistics {
 
@@ -31,7 +34,8 @@ namespace Statistics {
 
 /**
     \class HistogramStatistic
-    Holder of data grouped into pre-determined width bins.
+    Holder of data grouped into pre-determined width bins.  The bins are kept in a dense array, with an extra
+    slot on either end counting the values that fall below or above the bins, so binning a value is O(1).
     \tparam BinDataType is the type of the data held in each bin (i.e. what data type described the width of the bin)
 */
 #define CountType   uint64_t
@@ -72,9 +76,8 @@ public:
         // Initialize other properties
         m_totalSummed      = 0;
         m_totalSummedSqr   = 0;
-        m_OOBMinCount      = 0;
-        m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
+        m_bins.assign((size_t)m_numBins + 2, 0);
         this->setCollectionCount(0);
 
         // Set the Name of this Statistic
@@ -85,58 +88,51 @@ public:
 
 protected:
     /**
-        Adds a new value to the histogram. The correct bin is identified and then incremented. If no bin can be found
-        to hold the value then a new bin is created.
+        Adds a new value to the histogram. The correct bin is identified and then incremented. Values outside of the
+        bins are counted in the out of bounds slots.
     */
-    void addData_impl_Ntimes(uint64_t N, BinDataType value) override
+    void addData_impl_Ntimes(uint64_t N, BinDataType value) override { binValue(N, value); }
+
+    void addData_impl(BinDataType value) override { binValue(1, value); }
+
+    void addData_impl_batch(const BinDataType* values, size_t count) override
     {
-        // Check to see if the value is above or below the min/max values
-        if ( value < getBinsMinValue() ) {
-            m_OOBMinCount += N;
-            return;
-        }
-        if ( value > getBinsMaxValue() ) {
-            m_OOBMaxCount += N;
-            return;
+        for ( size_t i = 0; i < count; ++i ) {
+            binValue(1, values[i]);
         }
+    }
 
-        // This value is to be binned...
-        // Add the "in limits" value to the total summation's
-        m_totalSummed += N * value;
-        m_totalSummedSqr += N * (value * value);
+private:
+    /**
+        Find the slot for a value and add N to it.  The bin offset is clamped into the out of bounds slots rather
+        than tested against the min/max values, so there are no branches on the value.
+    */
+    void binValue(uint64_t N, BinDataType value)
+    {
+        // To support signed and unsigned values along with floating point types, the bin offset must be computed
+        // in floating point.  Anything below the bins (including NaN) clamps to slot 0 and anything above them to
+        // slot m_numBins + 1.
+        double offset = std::floor(((double)value - (double)m_minValue) / (double)m_binWidth);
+        offset        = std::min(std::max(-1.0, offset), (double)m_numBins);
+        size_t slot   = (size_t)(offset + 1.0);
+        m_bins[slot] += N;
+
+        // Only add the "in limits" values to the total summation's.  The value is selected rather than multiplied
+        // by inRange, since 0 * NaN or 0 * inf would still poison the sums.
+        CountType   inRange = (slot != 0) & (slot != (size_t)m_numBins + 1);
+        BinDataType binned  = inRange ? value : (BinDataType)0;
+        m_totalSummed += N * binned;
+        m_totalSummedSqr += N * (binned * binned);
 
         // Increment the Binned count (note this <= to the Statistics added Item Count)
-        m_itemsBinnedCount++;
-
-        // Figure out what the starting bin is and find it in the map
-        // To support signed and unsigned values along with floating point types,
-        // the calculation to find the bin_start value must be done in floating point
-        // then converted to BinDataType
-        double      calc1     = (double)value / (double)m_binWidth;
-        double      calc2     = floor(calc1); // Find the floor of the value
-        double      calc3     = m_binWidth * calc2;
-        BinDataType bin_start = (BinDataType)calc3;
-        //      printf("DEBUG: value = %d, junk1 = %f, calc2 = %f, calc3 = %f : bin_start = %d, item count = %ld, \n",
-        //      value, calc1, calc2, calc3, bin_start, getStatCollectionCount());
-
-        HistoMapItr_t bin_itr = m_binsMap.find(bin_start);
-
-        // Was the bin found?
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, Create the bin and set a value of 1 to it
-            m_binsMap.insert(std::pair<BinDataType, CountType>(bin_start, (CountType)N));
-        }
-        else {
-            // Yes, Increment the specific bin's count
-            bin_itr->second += N;
-        }
+        m_itemsBinnedCount += inRange;
     }
 
-    void addData_impl(BinDataType value) override { addData_impl_Ntimes(1, value); }
-
-private:
     /** Count how many bins are active in this histogram */
-    NumBinsType getActiveBinCount() { return m_binsMap.size(); }
+    NumBinsType getActiveBinCount()
+    {
+        return std::count_if(m_bins.begin() + 1, m_bins.end() - 1, [](CountType count) { return count != 0; });
+    }
 
     /** Count how many bins are available */
     NumBinsType getNumBins() { return m_numBins; }
@@ -144,26 +140,6 @@ private:
     /** Get the width of a bin in this histogram */
     NumBinsType getBinWidth() { return m_binWidth; }
 
-    /**
-        Get the count of items in the bin by the start value (e.g. give me the count of items in the bin which begins at
-       value X). \return The count of items in the bin else 0.
-    */
-    CountType getBinCountByBinStart(BinDataType binStartValue)
-    {
-        // Find the Bin Start Value in the Bin Map
-        HistoMapItr_t bin_itr = m_binsMap.find(binStartValue);
-
-        // Check to see if the Start Value was found
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, return no count for this bin
-            return (CountType)0;
-        }
-        else {
-            // Yes, return the bin count
-            return m_binsMap[binStartValue];
-        }
-    }
-
     /**
         Get the smallest start value of a bin in this histogram (i.e. the minimum value possibly represented by this
        histogram)
@@ -216,10 +192,8 @@ private:
     {
         m_totalSummed      = 0;
         m_totalSummedSqr   = 0;
-        m_OOBMinCount      = 0;
-        m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
-        m_binsMap.clear();
+        std::fill(m_bins.begin(), m_bins.end(), 0);
         this->setCollectionCount(0);
     }
 
@@ -272,17 +246,14 @@ private:
         statOutput->outputField(m_Fields[x++], getItemsBinnedCount());
 
         if ( true == m_includeOutOfBounds ) {
-            statOutput->outputField(m_Fields[x++], m_OOBMinCount);
-            statOutput->outputField(m_Fields[x++], m_OOBMaxCount);
+            statOutput->outputField(m_Fields[x++], m_bins.front());
+            statOutput->outputField(m_Fields[x++], m_bins.back());
         }
 
         // Do we also need to dump the bin counts on output
         if ( true == m_dumpBinsOnOutput ) {
-            BinDataType currentBinValue = getBinsMinValue();
             for ( uint32_t y = 0; y < getNumBins(); y++ ) {
-                statOutput->outputField(m_Fields[x++], getBinCountByBinStart(currentBinValue));
-                // Increment the currentBinValue to get the next bin
-                currentBinValue += getBinWidth();
+                statOutput->outputField(m_Fields[x++], m_bins[y + 1]);
             }
         }
     }
@@ -301,12 +272,6 @@ private:
     }
 
 private:
-    // Bin Map Definition
-    typedef std::map<BinDataType, CountType> HistoMap_t;
-
-    // Iterator over the histogram bins
-    typedef typename HistoMap_t::iterator HistoMapItr_t;
-
     // The minimum value in the Histogram
     BinDataType m_minValue;
 
@@ -316,10 +281,6 @@ private:
     // The number of bins to be supported
     NumBinsType m_numBins;
 
-    // Out of bounds bins
-    CountType m_OOBMinCount;
-    CountType m_OOBMaxCount;
-
     // Count of Items that have binned, (Different than item count as some
     // items may be out of bounds and not binned)
     CountType m_itemsBinnedCount;
@@ -332,8 +293,9 @@ private:
     // values such as variance.
     BinDataType m_totalSummedSqr;
 
-    // A map of the the bin starts to the bin counts
-    HistoMap_t m_binsMap;
+    // The bin counts.  Slot 0 counts the values below the bins, slot m_numBins + 1 the values above them, and
+    // bin y is held in slot y + 1
+    std::vector<CountType> m_bins;
 
     // Support
     std::vector<uint32_t> m_Fields;
@@ -0,0 +1,305 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATLOGHISTOGRAM_H
+#define SST_CORE_STATAPI_STATLOGHISTOGRAM_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class LogHistogramStatistic
+
+    Holder of data grouped into log-scale bins, suited to latency
+    distributions that span several orders of magnitude.  Offsets from
+    minvalue below subbins each get a bin of width 1.  Above that, every
+    power of two range [2^e, 2^(e+1)) is split into subbins equal width
+    bins, so the relative error of a bin is bounded by 1/subbins no matter
+    how large the value is.  As with HistogramStatistic, the bins are kept
+    in a dense array and binning a value is O(1).
+
+    Parameters: minvalue (default 0) and maxvalue (default 2^32 - 1, rounded
+    up to the end of its bin) bound the bins, subbins (default 16) is
+    rounded up to a power of two, and dumpbinsonoutput and
+    includeoutofbounds behave as for HistogramStatistic.
+
+    @tparam BinDataType is the type of the data being binned
+*/
+template <class BinDataType>
+class LogHistogramStatistic : public Statistic<BinDataType>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        LogHistogramStatistic,
+        "sst",
+        "LogHistogramStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Track distribution of statistic across log-scale bins",
+        "SST::Statistic<T>")
+
+    LogHistogramStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<BinDataType>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("minvalue");
+        allowedKeySet.insert("maxvalue");
+        allowedKeySet.insert("subbins");
+        allowedKeySet.insert("dumpbinsonoutput");
+        allowedKeySet.insert("includeoutofbounds");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        // Default the max value to 2^32 - 1, or the largest value the type can hold if that is smaller
+        BinDataType defaultMax = (BinDataType)std::min<double>(std::numeric_limits<BinDataType>::max(), 4294967295.0);
+
+        // Process the Parameters
+        m_minValue           = statParams.find<BinDataType>("minvalue", 0);
+        m_maxValue           = statParams.find<BinDataType>("maxvalue", defaultMax);
+        uint32_t subBins     = statParams.find<uint32_t>("subbins", 16);
+        m_dumpBinsOnOutput   = statParams.find<bool>("dumpbinsonoutput", true);
+        m_includeOutOfBounds = statParams.find<bool>("includeoutofbounds", true);
+
+        // Round the sub-bins up to a power of two so the bin index is just shifts
+        m_subBinsLog2 = 0;
+        while ( (1u << m_subBinsLog2) < subBins && m_subBinsLog2 < 16 )
+            m_subBinsLog2++;
+
+        // The bins run up to the end of the bin holding maxvalue
+        bool     below;
+        uint64_t maxOffset = getOffset(m_maxValue, below);
+        m_numBins          = below ? 1 : getBinIndex(maxOffset) + 1;
+
+        // Initialize other properties
+        m_totalSummed      = 0;
+        m_totalSummedSqr   = 0;
+        m_itemsBinnedCount = 0;
+        m_bins.assign(m_numBins + 2, 0);
+        this->setCollectionCount(0);
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("LogHistogram");
+    }
+
+    ~LogHistogramStatistic() {}
+
+protected:
+    void addData_impl_Ntimes(uint64_t N, BinDataType value) override { binValue(N, value); }
+
+    void addData_impl(BinDataType value) override { binValue(1, value); }
+
+    void addData_impl_batch(const BinDataType* values, size_t count) override
+    {
+        for ( size_t i = 0; i < count; ++i ) {
+            binValue(1, values[i]);
+        }
+    }
+
+private:
+    /**
+        Get the offset of a value from minvalue.  below is set if the value is less than minvalue (or is NaN), in
+        which case the offset is meaningless.
+    */
+    uint64_t getOffset(BinDataType value, bool& below) const
+    {
+        if constexpr ( std::is_floating_point<BinDataType>::value ) {
+            double offset = (double)value - (double)m_minValue;
+            below         = !(offset >= 0.0);
+            return (uint64_t)std::min(std::max(0.0, offset), 1.8e19);
+        }
+        else {
+            below = value < m_minValue;
+            return (uint64_t)value - (uint64_t)m_minValue;
+        }
+    }
+
+    /**
+        Get the bin holding an offset.  Offsets below subbins map straight to their bin.  Offsets in
+        [2^e, 2^(e+1)) use bins of width 2^shift, where shift = e - log2(subbins), which start at bin
+        shift * subbins + subbins.
+    */
+    uint64_t getBinIndex(uint64_t offset) const
+    {
+        int shift = std::max(0, 63 - __builtin_clzll(offset | 1) - (int)m_subBinsLog2);
+        return ((uint64_t)shift << m_subBinsLog2) + (offset >> shift);
+    }
+
+    /** Get the smallest offset held in a bin */
+    uint64_t getBinLowerOffset(uint64_t bin) const
+    {
+        uint64_t shift = std::max<uint64_t>(bin >> m_subBinsLog2, 1) - 1;
+        return (bin - (shift << m_subBinsLog2)) << shift;
+    }
+
+    /**
+        Get the largest value held in a bin.  This is computed from the bin's own width rather than from the start
+        of the next bin, which can overflow for the last bins below 2^64, and is clamped to the largest value the
+        type can hold.
+    */
+    BinDataType getBinUpperValue(uint64_t bin) const
+    {
+        uint64_t shift = std::max<uint64_t>(bin >> m_subBinsLog2, 1) - 1;
+        uint64_t upper = getBinLowerOffset(bin) + (((uint64_t)1 << shift) - 1);
+        if constexpr ( std::is_floating_point<BinDataType>::value ) {
+            return m_minValue + (BinDataType)upper;
+        }
+        else {
+            uint64_t maxOffset = (uint64_t)std::numeric_limits<BinDataType>::max() - (uint64_t)m_minValue;
+            return (BinDataType)((uint64_t)m_minValue + std::min(upper, maxOffset));
+        }
+    }
+
+    /** Find the slot for a value and add N to it.  Slot 0 and slot m_numBins + 1 count the out of bounds values. */
+    void binValue(uint64_t N, BinDataType value)
+    {
+        bool     below;
+        uint64_t offset = getOffset(value, below);
+        size_t   slot   = (size_t)(std::min(getBinIndex(offset), m_numBins) + 1) * !below;
+        m_bins[slot] += N;
+
+        // Only add the "in limits" values to the total summation's.  The value is selected rather than multiplied
+        // by inRange, since 0 * NaN or 0 * inf would still poison the sums.
+        uint64_t    inRange = (slot != 0) & (slot != m_numBins + 1);
+        BinDataType binned  = inRange ? value : (BinDataType)0;
+        m_totalSummed += N * binned;
+        m_totalSummedSqr += N * (binned * binned);
+        m_itemsBinnedCount += inRange;
+    }
+
+    /** Count how many bins are active in this histogram */
+    uint64_t getActiveBinCount()
+    {
+        return std::count_if(m_bins.begin() + 1, m_bins.end() - 1, [](uint64_t count) { return count != 0; });
+    }
+
+    /** Get the largest value held in the last bin */
+    BinDataType getBinsMaxValue() { return getBinUpperValue(m_numBins - 1); }
+
+    void clearStatisticData() override
+    {
+        m_totalSummed      = 0;
+        m_totalSummedSqr   = 0;
+        m_itemsBinnedCount = 0;
+        std::fill(m_bins.begin(), m_bins.end(), 0);
+        this->setCollectionCount(0);
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        m_Fields.push_back(statOutput->registerField<BinDataType>("BinsMinValue"));
+        m_Fields.push_back(statOutput->registerField<BinDataType>("BinsMaxValue"));
+        m_Fields.push_back(statOutput->registerField<uint32_t>("SubBins"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("TotalNumBins"));
+        m_Fields.push_back(statOutput->registerField<BinDataType>("Sum"));
+        m_Fields.push_back(statOutput->registerField<BinDataType>("SumSQ"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("NumActiveBins"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("NumItemsCollected"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("NumItemsBinned"));
+
+        if ( true == m_includeOutOfBounds ) {
+            m_Fields.push_back(statOutput->registerField<uint64_t>("NumOutOfBounds-MinValue"));
+            m_Fields.push_back(statOutput->registerField<uint64_t>("NumOutOfBounds-MaxValue"));
+        }
+
+        // Do we also need to dump the bin counts on output
+        if ( true == m_dumpBinsOnOutput ) {
+            for ( uint64_t y = 0; y < m_numBins; y++ ) {
+                // Figure out the upper and lower values for this bin
+                BinDataType binLL = m_minValue + (BinDataType)getBinLowerOffset(y);
+                BinDataType binUL = getBinUpperValue(y);
+                // Build the string name for this bin and add it as a field
+                std::stringstream ss;
+                ss << "Bin" << y << ":" << binLL << "-" << binUL;
+                m_Fields.push_back(statOutput->registerField<uint64_t>(ss.str().c_str()));
+            }
+        }
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        uint32_t x = 0;
+        statOutput->outputField(m_Fields[x++], m_minValue);
+        statOutput->outputField(m_Fields[x++], getBinsMaxValue());
+        statOutput->outputField(m_Fields[x++], (uint32_t)(1u << m_subBinsLog2));
+        statOutput->outputField(m_Fields[x++], m_numBins);
+        statOutput->outputField(m_Fields[x++], m_totalSummed);
+        statOutput->outputField(m_Fields[x++], m_totalSummedSqr);
+        statOutput->outputField(m_Fields[x++], getActiveBinCount());
+        statOutput->outputField(m_Fields[x++], this->getCollectionCount());
+        statOutput->outputField(m_Fields[x++], m_itemsBinnedCount);
+
+        if ( true == m_includeOutOfBounds ) {
+            statOutput->outputField(m_Fields[x++], m_bins.front());
+            statOutput->outputField(m_Fields[x++], m_bins.back());
+        }
+
+        // Do we also need to dump the bin counts on output
+        if ( true == m_dumpBinsOnOutput ) {
+            for ( uint64_t y = 0; y < m_numBins; y++ ) {
+                statOutput->outputField(m_Fields[x++], m_bins[y + 1]);
+            }
+        }
+    }
+
+    bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
+    {
+        switch ( mode ) {
+        case StatisticBase::STAT_MODE_COUNT:
+        case StatisticBase::STAT_MODE_PERIODIC:
+        case StatisticBase::STAT_MODE_DUMP_AT_END:
+            return true;
+        default:
+            return false;
+        }
+        return false;
+    }
+
+private:
+    // The smallest and largest values held in the bins
+    BinDataType m_minValue;
+    BinDataType m_maxValue;
+
+    // log2 of the number of bins each power of two range is split into
+    uint32_t m_subBinsLog2;
+
+    // The number of bins, not counting the out of bounds slots
+    uint64_t m_numBins;
+
+    // Count of Items that have binned
+    uint64_t m_itemsBinnedCount;
+
+    // The sum of the binned values and of their squares
+    BinDataType m_totalSummed;
+    BinDataType m_totalSummedSqr;
+
+    // The bin counts.  Slot 0 counts the values below the bins, slot m_numBins + 1 the values above them, and
+    // bin y is held in slot y + 1
+    std::vector<uint64_t> m_bins;
+
+    // Support
+    std::vector<uint32_t> m_Fields;
+    bool                  m_dumpBinsOnOutput;
+    bool                  m_includeOutOfBounds;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATLOGHISTOGRAM_H
@@ -18,9 +18,21 @@
 #include "sst/core/statapi/statgroup.h"
 #include "sst/core/stringize.h"
 
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
 namespace SST {
 namespace Statistics {
 
+namespace {
+// Set on the background writer thread while it writes out a buffered
+// statistic, so the output sees the time and rank it was sampled at
+thread_local bool      replaying_output = false;
+thread_local SimTime_t replay_sim_cycle = 0;
+thread_local int       replay_rank      = 0;
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 
 StatisticOutput::StatisticOutput(Params& outputParameters)
@@ -62,6 +74,264 @@ StatisticFieldsOutput::StatisticFieldsOutput(Params& outputParameters) : Statist
     m_currentFieldStatName = "";
 }
 
+/**
+ * Buffers the output of a StatisticFieldsOutput and writes it on a
+ * background thread.
+ *
+ * Statistics are passed this object instead of the real output in
+ * outputStatisticFields(), so the simulation thread only copies the
+ * field values into a preallocated buffer.  The background thread
+ * swaps the filled buffer for an empty one and replays it through the
+ * real output, which does the formatting, compression and file I/O.
+ * If the background thread falls behind, simulation threads wait for
+ * it once the buffer is full.
+ */
+class StatisticFieldsOutput::AsyncWriter final : public StatisticFieldsOutput
+{
+public:
+    AsyncWriter(StatisticFieldsOutput* output) :
+        StatisticFieldsOutput(output->getOutputParameters()),
+        m_output(output),
+        m_stop(false)
+    {
+        m_filling.reserve();
+        m_writer = std::thread(&AsyncWriter::run, this);
+    }
+
+    ~AsyncWriter()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_stop = true;
+        }
+        m_ready.notify_one();
+        m_writer.join();
+    }
+
+    void queueStatistic(StatisticBase* stat, bool endOfSimFlag)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        waitForSpace(lock);
+        stat->outputStatisticFields(this, endOfSimFlag);
+        addEntry(Entry::STATISTIC, stat, nullptr);
+        lock.unlock();
+        m_ready.notify_one();
+    }
+
+    void queueGroup(StatisticGroup* group, bool endOfSimFlag)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        waitForSpace(lock);
+        addEntry(Entry::GROUP_START, nullptr, group);
+        for ( auto& stat : group->stats ) {
+            stat->outputStatisticFields(this, endOfSimFlag);
+            addEntry(Entry::STATISTIC, stat, nullptr);
+        }
+        addEntry(Entry::GROUP_STOP, nullptr, nullptr);
+        lock.unlock();
+        m_ready.notify_one();
+    }
+
+    // Called by the statistics from queueStatistic() and queueGroup()
+    // with m_mutex held
+    void outputField(fieldHandle_t handle, int32_t data) override { addField(handle, Field::I32).i32 = data; }
+    void outputField(fieldHandle_t handle, uint32_t data) override { addField(handle, Field::U32).u32 = data; }
+    void outputField(fieldHandle_t handle, int64_t data) override { addField(handle, Field::I64).i64 = data; }
+    void outputField(fieldHandle_t handle, uint64_t data) override { addField(handle, Field::U64).u64 = data; }
+    void outputField(fieldHandle_t handle, float data) override { addField(handle, Field::F32).f32 = data; }
+    void outputField(fieldHandle_t handle, double data) override { addField(handle, Field::F64).f64 = data; }
+
+protected:
+    bool checkOutputParameters() override { return true; }
+    void printUsage() override {}
+    void startOfSimulation() override {}
+    void endOfSimulation() override {}
+    void implStartOutputEntries(StatisticBase* UNUSED(statistic)) override {}
+    void implStopOutputEntries() override {}
+
+private:
+    struct Field
+    {
+        enum Type : uint8_t { I32, U32, I64, U64, F32, F64 };
+
+        fieldHandle_t handle;
+        Type          type;
+        union {
+            int32_t  i32;
+            uint32_t u32;
+            int64_t  i64;
+            uint64_t u64;
+            float    f32;
+            double   f64;
+        };
+    };
+
+    struct Entry
+    {
+        enum Kind : uint8_t { STATISTIC, GROUP_START, GROUP_STOP };
+
+        Kind            kind;
+        StatisticBase*  stat;
+        StatisticGroup* group;
+        SimTime_t       sim_cycle;
+        int             rank;
+        size_t          fields_end; // One past the index of the entry's last field
+    };
+
+    struct Buffer
+    {
+        // Number of fields a buffer holds before simulation threads
+        // wait for the writer
+        static constexpr size_t capacity = 1 << 16;
+
+        std::vector<Entry> entries;
+        std::vector<Field> fields;
+
+        void reserve()
+        {
+            entries.reserve(capacity / 4);
+            fields.reserve(capacity);
+        }
+        void clear()
+        {
+            entries.clear();
+            fields.clear();
+        }
+    };
+
+    void waitForSpace(std::unique_lock<std::mutex>& lock)
+    {
+        m_space.wait(lock, [this] { return m_filling.fields.size() < Buffer::capacity; });
+    }
+
+    // Entries are added after the fields of their statistic
+    void addEntry(Entry::Kind kind, StatisticBase* stat, StatisticGroup* group)
+    {
+        Simulation_impl* sim = Simulation_impl::getSimulation();
+        m_filling.entries.push_back({ kind, stat, group, sim->getCurrentSimCycle(), (int)sim->getRank().rank,
+                                      m_filling.fields.size() });
+    }
+
+    Field& addField(fieldHandle_t fieldHandle, Field::Type type)
+    {
+        m_filling.fields.emplace_back();
+        Field& field = m_filling.fields.back();
+        field.handle = fieldHandle;
+        field.type   = type;
+        return field;
+    }
+
+    void run()
+    {
+        Buffer writing;
+        writing.reserve();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while ( true ) {
+            m_ready.wait(lock, [this] { return m_stop || !m_filling.entries.empty(); });
+            if ( m_filling.entries.empty() ) break;
+
+            std::swap(writing, m_filling);
+            lock.unlock();
+            m_space.notify_all();
+
+            write(writing);
+            writing.clear();
+
+            lock.lock();
+        }
+    }
+
+    void write(const Buffer& buffer)
+    {
+        m_output->lock();
+        replaying_output = true;
+
+        size_t field = 0;
+        for ( auto& entry : buffer.entries ) {
+            replay_sim_cycle = entry.sim_cycle;
+            replay_rank      = entry.rank;
+            switch ( entry.kind ) {
+            case Entry::GROUP_START:
+                m_output->startOutputGroup(entry.group);
+                break;
+            case Entry::GROUP_STOP:
+                m_output->stopOutputGroup();
+                break;
+            case Entry::STATISTIC:
+                m_output->startOutputEntries(entry.stat);
+                for ( ; field < entry.fields_end; ++field ) {
+                    writeField(buffer.fields[field]);
+                }
+                m_output->stopOutputEntries();
+                break;
+            }
+        }
+
+        replaying_output = false;
+        m_output->unlock();
+    }
+
+    void writeField(const Field& field)
+    {
+        switch ( field.type ) {
+        case Field::I32:
+            m_output->outputField(field.handle, field.i32);
+            break;
+        case Field::U32:
+            m_output->outputField(field.handle, field.u32);
+            break;
+        case Field::I64:
+            m_output->outputField(field.handle, field.i64);
+            break;
+        case Field::U64:
+            m_output->outputField(field.handle, field.u64);
+            break;
+        case Field::F32:
+            m_output->outputField(field.handle, field.f32);
+            break;
+        case Field::F64:
+            m_output->outputField(field.handle, field.f64);
+            break;
+        }
+    }
+
+    StatisticFieldsOutput*  m_output;
+    std::thread             m_writer;
+    std::mutex              m_mutex;
+    std::condition_variable m_ready; // Signaled when there is data to write or the writer should stop
+    std::condition_variable m_space; // Signaled when the writer takes the filled buffer
+    bool                    m_stop;
+    Buffer                  m_filling;
+};
+
+void
+StatisticFieldsOutput::startAsyncOutput()
+{
+    if ( nullptr == m_asyncWriter ) m_asyncWriter = new AsyncWriter(this);
+}
+
+void
+StatisticFieldsOutput::stopAsyncOutput()
+{
+    delete m_asyncWriter;
+    m_asyncWriter = nullptr;
+}
+
+SimTime_t
+StatisticFieldsOutput::getOutputSimCycle()
+{
+    if ( replaying_output ) return replay_sim_cycle;
+    return Simulation_impl::getSimulation()->getCurrentSimCycle();
+}
+
+int
+StatisticFieldsOutput::getOutputRank()
+{
+    if ( replaying_output ) return replay_rank;
+    return Simulation_impl::getSimulation()->getRank().rank;
+}
+
 StatisticFieldInfo*
 StatisticFieldsOutput::addFieldToLists(const char* fieldName, fieldType_t fieldType)
 {
@@ -152,6 +422,11 @@ StatisticFieldsOutput::outputField(fieldHandle_t UNUSED(fieldHandle), uint64_t U
 void
 StatisticFieldsOutput::output(StatisticBase* statistic, bool endOfSimFlag)
 {
+    if ( m_asyncWriter ) {
+        m_asyncWriter->queueStatistic(statistic, endOfSimFlag);
+        return;
+    }
+
     this->lock();
     startOutputEntries(statistic);
     statistic->outputStatisticFields(this, endOfSimFlag);
@@ -159,6 +434,16 @@ StatisticFieldsOutput::output(StatisticBase* statistic, bool endOfSimFlag)
     this->unlock();
 }
 
+void
+StatisticFieldsOutput::outputGroup(StatisticGroup* group, bool endOfSimFlag)
+{
+    if ( m_asyncWriter ) {
+        m_asyncWriter->queueGroup(group, endOfSimFlag);
+        return;
+    }
+    StatisticOutput::outputGroup(group, endOfSimFlag);
+}
+
 void
 StatisticFieldsOutput::startRegisterGroup(StatisticGroup* UNUSED(group))
 {
@@ -208,9 +493,13 @@ StatisticFieldsOutput::getFieldTypeShortName(fieldType_t type)
 void
 StatisticFieldsOutput::registerStatistic(StatisticBase* stat)
 {
+    // Locked since statistics registered after the simulation starts
+    // may race with the background writer
+    this->lock();
     startRegisterFields(stat);
     stat->registerOutputFields(this);
     stopRegisterFields();
+    this->unlock();
 }
 
 // Start / Stop of register
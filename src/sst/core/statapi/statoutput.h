@@ -112,7 +112,6 @@ private:
     virtual void registerStatistic(StatisticBase* stat) = 0;
 
     void registerGroup(StatisticGroup* group);
-    void outputGroup(StatisticGroup* group, bool endOfSimFlag);
 
     virtual void startOutputGroup(StatisticGroup* group) = 0;
     virtual void stopOutputGroup()                       = 0;
@@ -123,6 +122,9 @@ private:
     void castError();
 
 protected:
+    /** Output all the statistics in a group */
+    virtual void outputGroup(StatisticGroup* group, bool endOfSimFlag);
+
     /** Construct a base StatisticOutput
      * @param outputParameters - The parameters for the statistic Output.
      */
@@ -146,6 +148,7 @@ public:
 
     // Start / Stop of output
     void output(StatisticBase* statistic, bool endOfSimFlag) override;
+    void outputGroup(StatisticGroup* group, bool endOfSimFlag) override;
 
     void startOutputGroup(StatisticGroup* group) override;
     void stopOutputGroup() override;
@@ -252,6 +255,18 @@ public:
      */
     const char* getFieldTypeShortName(fieldType_t type);
 
+    /** Have output written by a background thread.  The simulation
+     * thread only copies the field values of each statistic into a
+     * buffer, and the background thread formats and writes them.
+     * Must be called before startOfSimulation().
+     */
+    void startAsyncOutput();
+
+    /** Write any buffered output and stop the background thread.
+     * Must be called before endOfSimulation().
+     */
+    void stopAsyncOutput();
+
 protected:
     /** Construct a base StatisticOutput
      * @param outputParameters - The parameters for the statistic Output.
@@ -261,6 +276,16 @@ protected:
     // For Serialization
     StatisticFieldsOutput() {}
 
+    /** Return the simulation cycle at which the statistic being output
+     * was sampled.  Derived classes must use this rather than the
+     * current cycle, which has moved on by the time buffered output is
+     * written.
+     */
+    static SimTime_t getOutputSimCycle();
+
+    /** Return the rank that sampled the statistic being output */
+    static int getOutputRank();
+
 private:
     // Other support functions
     StatisticFieldInfo* addFieldToLists(const char* fieldName, fieldType_t fieldType);
@@ -272,6 +297,9 @@ private:
     fieldHandle_t    m_highestFieldHandle;
     std::string      m_currentFieldStatName;
 
+    class AsyncWriter;
+    AsyncWriter* m_asyncWriter = nullptr;
+
 protected:
     /** These can be overriden, if necessary, but must be callable
      *  by the derived class */
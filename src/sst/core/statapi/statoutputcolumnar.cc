@@ -0,0 +1,324 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statoutputcolumnar.h"
+
+#include "sst/core/simulation_impl.h"
+#include "sst/core/stringize.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace SST {
+namespace Statistics {
+
+namespace {
+const char     columnar_magic[8] = { 'S', 'S', 'T', 'C', 'O', 'L', 'M', 'N' };
+const uint32_t columnar_version  = 1;
+const uint32_t byte_order_mark   = 0x01020304;
+// Chunks are padded so every chunk starts on this boundary
+const size_t   chunk_alignment   = 8;
+} // anonymous namespace
+
+StatisticOutputColumnar::StatisticOutputColumnar(Params& outputParameters) :
+    StatisticFieldsOutput(outputParameters),
+    m_hFile(nullptr),
+    m_bufferedBytes(0),
+    m_fileOffset(0),
+    m_currentTable(nullptr)
+{
+    // Announce this output object's name
+    Output& out = Simulation_impl::getSimulationOutput();
+    out.verbose(CALL_INFO, 1, 0, " : StatisticOutputColumnar enabled...\n");
+    setStatisticOutputName("StatisticOutputColumnar");
+}
+
+bool
+StatisticOutputColumnar::checkOutputParameters()
+{
+    bool foundKey;
+
+    // Look for Help Param
+    getOutputParameters().find<std::string>("help", "1", foundKey);
+    if ( true == foundKey ) { return false; }
+
+    // Get the parameters
+    m_FilePath   = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.sstcol");
+    m_bufferSize = getOutputParameters().find<size_t>("buffersize", 16 << 20);
+
+    // Perform some checking on the parameters
+    if ( 0 == m_FilePath.length() ) {
+        // Filepath is zero length
+        return false;
+    }
+    if ( 0 == m_bufferSize ) { return false; }
+
+    return true;
+}
+
+void
+StatisticOutputColumnar::printUsage()
+{
+    // Display how to use this output object
+    Output out("", 0, 0, Output::STDOUT);
+    out.output(" : Usage - Sends all statistic output to a binary file with one typed column per field.\n");
+    out.output(" : Parameters:\n");
+    out.output(" : help = Force Statistic Output to display usage\n");
+    out.output(" : filepath = <Path to output file> - Default is ./StatisticOutput.sstcol\n");
+    out.output(" : buffersize = <bytes> - Rows buffered before columns are written out - Default is 16777216\n");
+}
+
+void
+StatisticOutputColumnar::startRegisterFields(StatisticBase* stat)
+{
+    StatisticFieldsOutput::startRegisterFields(stat);
+
+    // A statistic shared by more than one slot is registered once per slot
+    auto iter = m_tableIndex.find(stat);
+    if ( iter != m_tableIndex.end() ) {
+        m_currentTable = &m_tables[iter->second];
+        return;
+    }
+
+    m_tableIndex[stat] = m_tables.size();
+    m_tables.emplace_back();
+    m_currentTable                = &m_tables.back();
+    m_currentTable->component     = stat->getCompName();
+    m_currentTable->statistic     = stat->getStatName();
+    m_currentTable->subid         = stat->getStatSubId();
+    m_currentTable->type          = stat->getStatTypeName();
+    m_currentTable->rows          = 0;
+    m_currentTable->buffered_rows = 0;
+
+    Column time;
+    time.name  = "SimTime";
+    time.type  = StatisticFieldInfo::getFieldTypeShortName(StatisticFieldType<uint64_t>::id());
+    time.width = sizeof(uint64_t);
+    m_currentTable->columns.push_back(time);
+    m_currentTable->row.push_back(0);
+}
+
+void
+StatisticOutputColumnar::implRegisteredField(fieldHandle_t fieldHandle)
+{
+    if ( m_currentTable->column_index.count(fieldHandle) ) return;
+
+    StatisticFieldInfo* fi        = getRegisteredField(fieldHandle);
+    fieldType_t         fieldType = fi->getFieldType();
+
+    Column column;
+    column.name  = fi->getFieldName();
+    column.type  = getFieldTypeShortName(fieldType);
+    column.width = (fieldType == StatisticFieldType<int32_t>::id() || fieldType == StatisticFieldType<uint32_t>::id() ||
+                    fieldType == StatisticFieldType<float>::id())
+                       ? 4
+                       : 8;
+
+    m_currentTable->column_index[fieldHandle] = m_currentTable->columns.size();
+    m_currentTable->columns.push_back(column);
+    m_currentTable->row.push_back(0);
+}
+
+void
+StatisticOutputColumnar::stopRegisterFields()
+{
+    StatisticFieldsOutput::stopRegisterFields();
+    m_currentTable = nullptr;
+}
+
+void
+StatisticOutputColumnar::startOfSimulation()
+{
+    // Set Filename with Rank if Num Ranks > 1
+    uint32_t num_ranks = Simulation_impl::getSimulation()->getNumRanks().rank;
+    uint32_t rank      = Simulation_impl::getSimulation()->getRank().rank;
+    if ( 1 < num_ranks ) {
+        std::string rankstr = "_" + std::to_string(rank);
+
+        // Search for any extension
+        size_t index = m_FilePath.find_last_of(".");
+        if ( std::string::npos != index ) {
+            // We found a . at the end of the file, insert the rank string
+            m_FilePath.insert(index, rankstr);
+        }
+        else {
+            // No . found, append the rank string
+            m_FilePath += rankstr;
+        }
+    }
+
+    m_hFile = fopen(m_FilePath.c_str(), "wb");
+    if ( nullptr == m_hFile ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, " : StatisticOutputColumnar - Problem opening File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+    }
+
+    write(columnar_magic, sizeof(columnar_magic));
+    writeValue(columnar_version);
+    writeValue(byte_order_mark);
+    writeValue(rank);
+    writeValue(num_ranks);
+}
+
+void
+StatisticOutputColumnar::endOfSimulation()
+{
+    flush();
+    writeIndex();
+    fclose(m_hFile);
+    m_hFile = nullptr;
+}
+
+void
+StatisticOutputColumnar::implStartOutputEntries(StatisticBase* statistic)
+{
+    m_currentTable = &m_tables[m_tableIndex.at(statistic)];
+
+    // Fields that are not output are written as 0
+    std::fill(m_currentTable->row.begin(), m_currentTable->row.end(), 0);
+    m_currentTable->row[0] = getOutputSimCycle();
+}
+
+void
+StatisticOutputColumnar::implStopOutputEntries()
+{
+    Table& table = *m_currentTable;
+    for ( size_t i = 0; i < table.columns.size(); ++i ) {
+        Column& column = table.columns[i];
+        size_t  pos    = column.buffer.size();
+        column.buffer.resize(pos + column.width);
+        std::memcpy(&column.buffer[pos], &table.row[i], column.width);
+        m_bufferedBytes += column.width;
+    }
+    table.rows++;
+    table.buffered_rows++;
+    m_currentTable = nullptr;
+
+    if ( m_bufferedBytes >= m_bufferSize ) flush();
+}
+
+template <typename T>
+void
+StatisticOutputColumnar::setField(fieldHandle_t fieldHandle, T data)
+{
+    auto iter = m_currentTable->column_index.find(fieldHandle);
+    if ( iter == m_currentTable->column_index.end() ) return;
+    std::memcpy(&m_currentTable->row[iter->second], &data, sizeof(T));
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, float data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, double data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::flush()
+{
+    static const char padding[chunk_alignment] = {};
+
+    for ( auto& table : m_tables ) {
+        if ( 0 == table.buffered_rows ) continue;
+        for ( auto& column : table.columns ) {
+            column.chunks.emplace_back(m_fileOffset, table.buffered_rows);
+            write(column.buffer.data(), column.buffer.size());
+            size_t pad = (chunk_alignment - m_fileOffset % chunk_alignment) % chunk_alignment;
+            write(padding, pad);
+            column.buffer.clear();
+        }
+        table.buffered_rows = 0;
+    }
+    m_bufferedBytes = 0;
+}
+
+void
+StatisticOutputColumnar::write(const void* data, size_t size)
+{
+    if ( 0 == size ) return;
+    if ( fwrite(data, 1, size, m_hFile) != size ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, " : StatisticOutputColumnar - Problem writing File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+    }
+    m_fileOffset += size;
+}
+
+void
+StatisticOutputColumnar::writeString(const std::string& str)
+{
+    writeValue<uint32_t>(str.size());
+    write(str.data(), str.size());
+}
+
+void
+StatisticOutputColumnar::writeIndex()
+{
+    uint64_t index_offset = m_fileOffset;
+
+    writeValue<uint64_t>(m_tables.size());
+    for ( auto& table : m_tables ) {
+        writeString(table.component);
+        writeString(table.statistic);
+        writeString(table.subid);
+        writeString(table.type);
+        writeValue<uint64_t>(table.rows);
+        writeValue<uint32_t>(table.columns.size());
+        for ( auto& column : table.columns ) {
+            writeString(column.name);
+            writeString(column.type);
+            writeValue<uint32_t>(column.width);
+            writeValue<uint64_t>(column.chunks.size());
+            for ( auto& chunk : column.chunks ) {
+                writeValue<uint64_t>(chunk.first);
+                writeValue<uint64_t>(chunk.second);
+            }
+        }
+    }
+
+    writeValue(index_offset);
+    write(columnar_magic, sizeof(columnar_magic));
+}
+
+} // namespace Statistics
+} // namespace SST
@@ -0,0 +1,179 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATOUTPUTCOLUMNAR_H
+#define SST_CORE_STATAPI_STATOUTPUTCOLUMNAR_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statoutput.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputColumnar
+
+    The class for statistics output to a binary file with one fixed
+    width, typed column per statistic field.  Post-processing tools can
+    memory map the file and read just the columns they need without
+    parsing any text.
+
+    Each statistic gets a table whose first column is the simulation
+    time (SimTime, u64) followed by one column per registered field.
+    Each output of the statistic adds a row to its table.  Rows are
+    buffered in memory and written out column by column in large
+    chunks.  An index at the end of the file records where the chunks
+    of each column are.
+
+    The file is written in the byte order of the machine that wrote it:
+
+      header:  char[8] "SSTCOLMN", u32 version (1), u32 byte order
+               mark (0x01020304), u32 rank, u32 number of ranks
+      chunks:  consecutive values of one column, padded to 8 bytes
+      index:   u64 number of tables, then for each table:
+                 str component, str statistic, str subid, str stat type,
+                 u64 rows, u32 number of columns, then for each column:
+                   str name, str type (i32, u32, i64, u64, f32 or f64),
+                   u32 width, u64 number of chunks, then for each chunk:
+                     u64 file offset, u64 rows
+      trailer: u64 file offset of the index, char[8] "SSTCOLMN"
+
+    where str is a u32 length followed by that many characters.
+*/
+class StatisticOutputColumnar : public StatisticFieldsOutput
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+      StatisticOutput,
+      StatisticOutputColumnar,
+      "sst",
+      "statoutputcolumnar",
+      SST_ELI_ELEMENT_VERSION(1,0,0),
+      "Output to a binary file with one typed column per statistic field"
+   )
+
+    /** Construct a StatOutputColumnar
+     * @param outputParameters - Parameters used for this Statistic Output
+     */
+    StatisticOutputColumnar(Params& outputParameters);
+
+protected:
+    /** Perform a check of provided parameters
+     * @return True if all required parameters and options are acceptable
+     */
+    bool checkOutputParameters() override;
+
+    /** Print out usage for this Statistic Output */
+    void printUsage() override;
+
+    void startRegisterFields(StatisticBase* stat) override;
+    void implRegisteredField(fieldHandle_t fieldHandle) override;
+    void stopRegisterFields() override;
+
+    /** Indicate to Statistic Output that simulation started.
+     *  Statistic output may perform any startup code here as necessary.
+     */
+    void startOfSimulation() override;
+
+    /** Indicate to Statistic Output that simulation ended.
+     *  Statistic output may perform any shutdown code here as necessary.
+     */
+    void endOfSimulation() override;
+
+    /** Implementation function for the start of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is about to send data to the Statistic Output for processing.
+     * @param statistic - Pointer to the statistic object than the output can
+     * retrieve data from.
+     */
+    void implStartOutputEntries(StatisticBase* statistic) override;
+
+    /** Implementation function for the end of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is finished sending data to the Statistic Output for processing.
+     * The Statistic Output can perform any output related functions here.
+     */
+    void implStopOutputEntries() override;
+
+    /** Implementation functions for output.
+     * These will be called by the statistic to provide Statistic defined
+     * data to be output.
+     * @param fieldHandle - The handle to the registered statistic field.
+     * @param data - The data related to the registered field to be output.
+     */
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+    /** True if this StatOutput can handle StatisticGroups */
+    bool acceptsGroups() const override { return true; }
+
+protected:
+    StatisticOutputColumnar() { ; } // For serialization
+
+private:
+    struct Column
+    {
+        std::string       name;
+        std::string       type;
+        uint32_t          width;
+        std::vector<char> buffer; // Values not yet written to the file
+        // File offset and number of rows of each chunk written so far
+        std::vector<std::pair<uint64_t, uint64_t>> chunks;
+    };
+
+    struct Table
+    {
+        std::string         component;
+        std::string         statistic;
+        std::string         subid;
+        std::string         type;
+        uint64_t            rows;
+        uint64_t            buffered_rows;
+        std::vector<Column> columns;
+        // Values of the row being output, each in the first width bytes
+        std::vector<uint64_t>                     row;
+        std::unordered_map<fieldHandle_t, size_t> column_index;
+    };
+
+    template <typename T>
+    void setField(fieldHandle_t fieldHandle, T data);
+
+    void flush();
+    void write(const void* data, size_t size);
+    void writeString(const std::string& str);
+    template <typename T>
+    void writeValue(T value)
+    {
+        write(&value, sizeof(T));
+    }
+    void writeIndex();
+
+    FILE*                                      m_hFile;
+    std::string                                m_FilePath;
+    size_t                                     m_bufferSize;
+    size_t                                     m_bufferedBytes;
+    uint64_t                                   m_fileOffset;
+    std::vector<Table>                         m_tables;
+    std::unordered_map<StatisticBase*, size_t> m_tableIndex;
+    Table*                                     m_currentTable;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATOUTPUTCOLUMNAR_H
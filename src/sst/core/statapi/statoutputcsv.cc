@@ -206,14 +206,14 @@ StatisticOutputCSV::implStopOutputEntries()
     // Done with Output, Send a line of data to the file
     if ( true == m_outputSimTime ) {
         // Add the Simulation Time to the front
-        print("%" PRIu64, Simulation_impl::getSimulation()->getCurrentSimCycle());
+        print("%" PRIu64, getOutputSimCycle());
         print("%s", m_Separator.c_str());
     }
 
     // Done with Output, Send a line of data to the file
     if ( true == m_outputRank ) {
         // Add the Simulation Time to the front
-        print("%d", Simulation_impl::getSimulation()->getRank().rank);
+        print("%d", getOutputRank());
         print("%s", m_Separator.c_str());
     }
 
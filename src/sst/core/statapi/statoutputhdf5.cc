@@ -215,7 +215,7 @@ StatisticOutputHDF5::StatisticInfo::startNewEntry(StatisticBase* UNUSED(stat))
     for ( StatData_u& i : currentData ) {
         memset(&i, '\0', sizeof(i));
     }
-    currentData[0].u64 = Simulation_impl::getSimulation()->getCurrentSimCycle();
+    currentData[0].u64 = getOutputSimCycle();
 }
 
 StatisticOutputHDF5::StatData_u&
@@ -495,7 +495,7 @@ StatisticOutputHDF5::GroupInfo::startNewGroupEntry()
     H5::DataSpace fspace = timeDataSet->getSpace();
     H5::DataSpace memSpace(1, dims);
     fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-    uint64_t currTime = Simulation_impl::getSimulation()->getCurrentSimCycle();
+    uint64_t currTime = getOutputSimCycle();
     timeDataSet->write(&currTime, H5::PredType::NATIVE_UINT64, memSpace, fspace);
 }
 
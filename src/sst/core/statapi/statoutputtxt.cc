@@ -162,10 +162,10 @@ StatisticOutputTextBase::implStartOutputEntries(StatisticBase* statistic)
     if ( true == m_outputSimTime ) {
         // Add the Simulation Time to the front
         if ( true == m_outputInlineHeader ) {
-            buffer = format_string("SimTime = %" PRIu64, Simulation_impl::getSimulation()->getCurrentSimCycle());
+            buffer = format_string("SimTime = %" PRIu64, getOutputSimCycle());
         }
         else {
-            buffer = format_string("%" PRIu64, Simulation_impl::getSimulation()->getCurrentSimCycle());
+            buffer = format_string("%" PRIu64, getOutputSimCycle());
         }
 
         m_outputBuffer += buffer;
@@ -175,10 +175,10 @@ StatisticOutputTextBase::implStartOutputEntries(StatisticBase* statistic)
     if ( true == m_outputRank ) {
         // Add the Rank to the front
         if ( true == m_outputInlineHeader ) {
-            buffer = format_string("Rank = %d", Simulation_impl::getSimulation()->getRank().rank);
+            buffer = format_string("Rank = %d", getOutputRank());
         }
         else {
-            buffer = format_string("%d", Simulation_impl::getSimulation()->getRank().rank);
+            buffer = format_string("%d", getOutputRank());
         }
 
         m_outputBuffer += buffer;
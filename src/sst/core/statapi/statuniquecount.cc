@@ -0,0 +1,146 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statuniquecount.h"
+
+#include "sst/core/objectComms.h"
+#include "sst/core/simulation_impl.h"
+
+#include <cmath>
+
+namespace SST {
+namespace Statistics {
+
+namespace {
+
+// Merge a set of registers into a merged set, which starts out empty
+void
+mergeRegisters(std::vector<uint8_t>& merged, const std::vector<uint8_t>& regs)
+{
+    if ( merged.empty() ) {
+        merged = regs;
+        return;
+    }
+    for ( size_t i = 0; i < merged.size() && i < regs.size(); ++i ) {
+        merged[i] = std::max(merged[i], regs[i]);
+    }
+}
+
+} // namespace
+
+std::mutex                                  HyperLogLog::global_mtx;
+std::multimap<std::string, HyperLogLog*>    HyperLogLog::global_sketches;
+std::map<std::string, std::vector<uint8_t>> HyperLogLog::global_merged;
+
+HyperLogLog::HyperLogLog(uint32_t precision) :
+    precision(std::min(std::max(precision, MIN_PRECISION), MAX_PRECISION)),
+    registers(1u << this->precision, 0)
+{}
+
+HyperLogLog::~HyperLogLog()
+{
+    if ( global_key.empty() ) return;
+
+    std::lock_guard<std::mutex> lock(global_mtx);
+    auto                        range = global_sketches.equal_range(global_key);
+    for ( auto it = range.first; it != range.second; ++it ) {
+        if ( it->second == this ) {
+            global_sketches.erase(it);
+            break;
+        }
+    }
+}
+
+void
+HyperLogLog::merge(const std::vector<uint8_t>& other)
+{
+    mergeRegisters(registers, other);
+}
+
+uint64_t
+HyperLogLog::estimate(const std::vector<uint8_t>& regs)
+{
+    double   m     = regs.size();
+    double   sum   = 0.0;
+    uint64_t zeros = 0;
+    for ( uint8_t r : regs ) {
+        sum += std::ldexp(1.0, -(int)r);
+        zeros += (r == 0);
+    }
+
+    double alpha;
+    if ( regs.size() == 16 )
+        alpha = 0.673;
+    else if ( regs.size() == 32 )
+        alpha = 0.697;
+    else if ( regs.size() == 64 )
+        alpha = 0.709;
+    else
+        alpha = 0.7213 / (1.0 + 1.079 / m);
+
+    double est = alpha * m * m / sum;
+
+    // Use linear counting while there are still empty registers and the
+    // raw estimate is small, where HyperLogLog is biased.  With 64-bit
+    // hashes no large range correction is needed.
+    if ( est <= 2.5 * m && zeros != 0 ) est = m * std::log(m / (double)zeros);
+
+    return (uint64_t)std::llround(est);
+}
+
+void
+HyperLogLog::setGlobalName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(global_mtx);
+    global_key = name + "@" + std::to_string(precision);
+    global_sketches.emplace(global_key, this);
+}
+
+uint64_t
+HyperLogLog::getGlobalEstimate() const
+{
+    auto it = global_merged.find(global_key);
+    if ( it == global_merged.end() ) return 0;
+    return estimate(it->second);
+}
+
+void
+HyperLogLog::mergeGlobal()
+{
+    std::lock_guard<std::mutex> lock(global_mtx);
+
+    // Merge the sketches on this rank
+    std::map<std::string, std::vector<uint8_t>> merged;
+    for ( auto& x : global_sketches ) {
+        mergeRegisters(merged[x.first], x.second->getRegisters());
+    }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Then merge across ranks.  Every rank has to take part, even if it
+    // has no sketches of its own.
+    if ( Simulation_impl::getSimulation()->getNumRanks().rank > 1 ) {
+        std::vector<std::map<std::string, std::vector<uint8_t>>> all_merged;
+        Comms::all_gather(merged, all_merged);
+        for ( auto& rank_merged : all_merged ) {
+            for ( auto& x : rank_merged ) {
+                mergeRegisters(merged[x.first], x.second);
+            }
+        }
+    }
+#endif
+
+    global_merged.swap(merged);
+}
+
+} // namespace Statistics
+} // namespace SST
@@ -14,8 +14,17 @@
 
 #include "sst/core/sst_types.h"
 #include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+#include <type_traits>
+#include <vector>
+
 namespace SST {
 class BaseComponent;
 namespace Statistics {
@@ -75,6 +84,173 @@ private:
     StatisticOutput::fieldHandle_t uniqueCountField;
 };
 
+/**
+    \class HyperLogLog
+
+    A HyperLogLog sketch of the distinct 64-bit hashes added to it.  The
+    sketch holds 2^precision one byte registers, so memory is fixed no
+    matter how many values are added, and the standard error of the
+    estimate is about 1.04 / sqrt(2^precision).  Two sketches with the same
+    precision merge by taking the max of each register.
+*/
+class HyperLogLog
+{
+public:
+    static constexpr uint32_t MIN_PRECISION = 4;
+    static constexpr uint32_t MAX_PRECISION = 18;
+
+    /** @param precision log2 of the number of registers, clamped to [MIN_PRECISION, MAX_PRECISION] */
+    explicit HyperLogLog(uint32_t precision);
+    ~HyperLogLog();
+
+    /** Add a hash to the sketch */
+    void add(uint64_t hash)
+    {
+        size_t index = hash >> (64 - precision);
+        // Position of the first set bit after the index bits.  The guard bit caps it at 64 - precision + 1.
+        uint8_t rank = __builtin_clzll((hash << precision) | (1ull << (precision - 1))) + 1;
+        registers[index] = std::max(registers[index], rank);
+    }
+
+    /** Merge another sketch's registers into this one.  The precisions must match. */
+    void merge(const std::vector<uint8_t>& other);
+
+    /** Get the estimated number of distinct hashes added */
+    uint64_t estimate() const { return estimate(registers); }
+
+    /** Get the estimated number of distinct hashes represented by a set of registers */
+    static uint64_t estimate(const std::vector<uint8_t>& regs);
+
+    void clear() { std::fill(registers.begin(), registers.end(), 0); }
+
+    uint32_t                    getPrecision() const { return precision; }
+    const std::vector<uint8_t>& getRegisters() const { return registers; }
+
+    /**
+        Include this sketch in the global merge under name.  All sketches
+        registered with the same name and precision, on every thread and
+        rank, are merged by mergeGlobal().
+    */
+    void setGlobalName(const std::string& name);
+
+    /**
+        Get the estimate for all the sketches merged with this one by the
+        last mergeGlobal(), or 0 if there has not been one
+    */
+    uint64_t getGlobalEstimate() const;
+
+    /**
+        Merge the registered sketches across threads and ranks.  Called by
+        one thread per rank at the end of simulation while the other threads
+        wait, since it reads every thread's sketches.
+    */
+    static void mergeGlobal();
+
+    /** Hash a value of up to 8 bytes */
+    template <typename T>
+    static uint64_t hash(T value)
+    {
+        static_assert(sizeof(T) <= sizeof(uint64_t), "HyperLogLog can only hash values of up to 8 bytes");
+        // -0.0 and 0.0 compare equal, so give them the same hash
+        if constexpr ( std::is_floating_point<T>::value ) value = value == 0 ? 0 : value;
+
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(T));
+
+        // splitmix64 finalizer, so every input bit affects the index and rank bits
+        bits = (bits ^ (bits >> 30)) * 0xbf58476d1ce4e5b9ull;
+        bits = (bits ^ (bits >> 27)) * 0x94d049bb133111ebull;
+        return bits ^ (bits >> 31);
+    }
+
+private:
+    uint32_t             precision;
+    std::vector<uint8_t> registers;
+    std::string          global_key;
+
+    // Sketches to merge, and the results of the last merge, by name and precision
+    static std::mutex                                  global_mtx;
+    static std::multimap<std::string, HyperLogLog*>    global_sketches;
+    static std::map<std::string, std::vector<uint8_t>> global_merged;
+};
+
+/**
+    \class ApproxUniqueCountStatistic
+
+    Creates a Statistic which estimates the number of unique values
+    provided to it with a HyperLogLog sketch.  Unlike
+    UniqueCountStatistic, memory does not grow with the number of unique
+    values and each add is O(1).
+
+    @tparam T A template for holding the main data type of this statistic
+*/
+
+template <typename T>
+class ApproxUniqueCountStatistic : public Statistic<T>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        ApproxUniqueCountStatistic,
+        "sst",
+        "ApproxUniqueCountStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Estimate unique occurrences of statistic with a HyperLogLog sketch",
+        "SST::Statistic<T>")
+
+    ApproxUniqueCountStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<T>(comp, statName, statSubId, statParams),
+        sketch(statParams.find<uint32_t>("precision", 12))
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("precision");
+        allowedKeySet.insert("global");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        // With global set, the sketches of every statistic with this name
+        // are merged at the end of simulation
+        global = statParams.find<bool>("global", false);
+        if ( global ) sketch.setGlobalName(statName);
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("ApproxUniqueCount");
+    }
+
+    ~ApproxUniqueCountStatistic() {};
+
+protected:
+    /**
+    Present a new value to the Statistic to be included in the estimate
+        @param data New data item to be included in the estimate
+    */
+    void addData_impl(T data) override { sketch.add(HyperLogLog::hash(data)); }
+
+    /** Adding the same value again does not change the sketch */
+    void addData_impl_Ntimes(uint64_t UNUSED(N), T data) override { sketch.add(HyperLogLog::hash(data)); }
+
+private:
+    void clearStatisticData() override { sketch.clear(); }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        uniqueCountField = statOutput->registerField<uint64_t>("UniqueItems");
+        if ( global ) globalUniqueCountField = statOutput->registerField<uint64_t>("GlobalUniqueItems");
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        statOutput->outputField(uniqueCountField, sketch.estimate());
+        if ( global ) statOutput->outputField(globalUniqueCountField, sketch.getGlobalEstimate());
+    }
+
+private:
+    HyperLogLog                    sketch;
+    bool                           global;
+    StatisticOutput::fieldHandle_t uniqueCountField;
+    StatisticOutput::fieldHandle_t globalUniqueCountField;
+};
+
 } // namespace Statistics
 } // namespace SST
 
@@ -51,6 +51,10 @@ SimTime_t RankSyncParallelSkip::myNextSyncTime = 0;
 
 RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
     RankSync(num_ranks),
+    reduce_pending(false),
+    skip_exchange(false),
+    reduce_input(0),
+    reduce_output(0),
     mpiWaitTime(0.0),
     deserializeTime(0.0),
     send_count(0),
@@ -61,7 +65,11 @@ RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UN
     // TraceFunction(CALL_INFO_LONG);
     max_period     = Simulation_impl::getSimulation()->getMinPartTC();
     myNextSyncTime = max_period->getFactor();
-    recv_count     = new int[num_ranks.thread];
+    nonblocking    = Simulation_impl::getSimulation()->nonblocking_rank_sync;
+    serializeReadyBarrier.setName("rank_sync.serialize_ready");
+    slaveExchangeDoneBarrier.setName("rank_sync.exchange_done");
+    allDoneBarrier.setName("rank_sync.all_done");
+    recv_count = new int[num_ranks.thread];
     for ( uint32_t i = 0; i < num_ranks.thread; i++ ) {
         recv_count[i] = 0;
     }
@@ -70,6 +78,8 @@ RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UN
 
 RankSyncParallelSkip::~RankSyncParallelSkip()
 {
+    waitForPending();
+
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
         delete i->second.squeue;
     }
@@ -138,7 +148,25 @@ RankSyncParallelSkip::finalizeLinkConfigurations()
 
 void
 RankSyncParallelSkip::prepareForComplete()
-{}
+{
+    // The untimed exchanges reuse the send buffers
+    waitForPending();
+}
+
+void
+RankSyncParallelSkip::waitForPending()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( reduce_pending ) {
+        MPI_Wait(&reduce_req, MPI_STATUS_IGNORE);
+        reduce_pending = false;
+    }
+    if ( !send_reqs.empty() ) {
+        MPI_Waitall(send_reqs.size(), send_reqs.data(), MPI_STATUSES_IGNORE);
+        send_reqs.clear();
+    }
+#endif
+}
 
 uint64_t
 RankSyncParallelSkip::getDataSize() const
@@ -163,9 +191,9 @@ RankSyncParallelSkip::execute(int thread)
         allDoneBarrier.wait(); /* Sync up with slave finish below */
     }
     else {
-        serializeReadyBarrier.wait(); /* Wait for exchange_master() to start up */
-        exchange_slave(thread);       /* Waits at the end */
-        allDoneBarrier.wait();        /* Wait for exchange_master to finish */
+        serializeReadyBarrier.wait();                /* Wait for exchange_master() to start up */
+        if ( !skip_exchange ) exchange_slave(thread); /* Waits at the end */
+        allDoneBarrier.wait();                       /* Wait for exchange_master to finish */
     }
 }
 
@@ -231,10 +259,40 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
 {
 #ifdef SST_CONFIG_HAVE_MPI
 
+    skip_exchange      = false;
+    exit_state_reduced = false;
+
+    if ( reduce_pending ) {
+        // Finish the reduction started at the last exchange.  If it
+        // shows that no event can cross a rank boundary yet, every
+        // rank skips the exchange and moves the sync out.
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Wait(&reduce_req, MPI_STATUS_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        reduce_pending = false;
+
+        SimTime_t next = reduce_output + max_period->getFactor();
+        if ( next > Simulation_impl::getSimulation()->getCurrentSimCycle() ) {
+            myNextSyncTime = next;
+            skip_exchange  = true;
+            serializeReadyBarrier.wait(); /* Release slaves, who will skip the exchange */
+            return;
+        }
+    }
+
+    // The send buffers are reused, so sends left in flight by the
+    // last exchange have to finish before serialization starts
+    if ( !send_reqs.empty() ) {
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Waitall(send_reqs.size(), send_reqs.data(), MPI_STATUSES_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        send_reqs.clear();
+    }
+
     // Maximum number of outstanding requests is 3 times the number
     // of ranks I communicate with (1 recv, 2 sends per rank)
-    MPI_Request sreqs[2 * comm_send_map.size()];
-    int         sreq_count = 0;
+    int sreq_count = 0;
+    send_reqs.resize(2 * comm_send_map.size());
 
     // First thing to do is fill the serialize_queue.
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
@@ -276,7 +334,7 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
                 hdr->mode = 1;
                 MPI_Isend(
                     send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, send->to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
-                    &sreqs[sreq_count++]);
+                    &send_reqs[sreq_count++]);
                 send->remote_size = hdr->buffer_size;
                 tag               = 2 * send->to_rank.thread + 1;
             }
@@ -285,7 +343,7 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
             }
             MPI_Isend(
                 send_buffer, hdr->buffer_size, MPI_BYTE, send->to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
+                &send_reqs[sreq_count++]);
         }
         else if ( serialize_queue.try_remove(send) ) {
             // Serialize the events
@@ -338,13 +396,18 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
         }
     }
 
+    send_reqs.resize(sreq_count);
+
     // For now simply call exchange_slave() to deliver events
     exchange_slave(0); /* Barriers at end */
 
-    // Clear the SyncQueues used to send the data after all the sends have completed
-    // waitStart = SST::Core::Profile::now();
-    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
-    // mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    if ( !nonblocking ) {
+        // Clear the SyncQueues used to send the data after all the sends have completed
+        // waitStart = SST::Core::Profile::now();
+        MPI_Waitall(send_reqs.size(), send_reqs.data(), MPI_STATUSES_IGNORE);
+        // mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        send_reqs.clear();
+    }
 
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
         i->second.squeue->clear();
@@ -356,11 +419,23 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
 
     // Need to get the local minimum, then do a global minimum
     // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
-    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    reduce_input = Simulation_impl::getLocalMinimumNextActivityTime();
+
+    if ( nonblocking ) {
+        // Leave the reduction running through the next window.  Nothing
+        // sent in the window can arrive before one period from now, so
+        // that is always a safe time for the next sync.
+        MPI_Iallreduce(&reduce_input, &reduce_output, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req);
+        reduce_pending = true;
+        myNextSyncTime = Simulation_impl::getSimulation()->getCurrentSimCycle() + max_period->getFactor();
+        return;
+    }
+
+    // Reduce the exit state along with the next sync time so the sync
+    // needs only one collective
+    reduce_output = reduceSyncValues(reduce_input);
 
-    myNextSyncTime = min_time + max_period->getFactor();
+    myNextSyncTime = reduce_output + max_period->getFactor();
 
 #endif
 }
@@ -18,6 +18,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <map>
+#include <vector>
 
 #ifdef SST_CONFIG_HAVE_MPI
 DISABLE_WARN_MISSING_OVERRIDE
@@ -60,6 +61,9 @@ private:
     void exchange_master(int thread);
     void exchange_slave(int thread);
 
+    // Complete any outstanding nonblocking operations
+    void waitForPending();
+
     struct comm_send_pair
     {
         RankInfo   to_rank;
@@ -91,6 +95,23 @@ private:
     comm_recv_map_t comm_recv_map;
     link_map_t      link_map;
 
+    // When nonblocking, the next sync time reduction and the sends
+    // are left in flight while the next window executes.  The next
+    // sync is conservatively scheduled one period out; if the
+    // reduction shows that nothing can cross a rank boundary by then,
+    // that sync skips the exchange and reschedules itself.
+    bool nonblocking;
+    bool reduce_pending;
+    // Set by the master thread when the current sync has nothing to
+    // exchange
+    bool skip_exchange;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Request              reduce_req;
+    std::vector<MPI_Request> send_reqs;
+#endif
+    SimTime_t reduce_input;
+    SimTime_t reduce_output;
+
     double mpiWaitTime;
     double deserializeTime;
 
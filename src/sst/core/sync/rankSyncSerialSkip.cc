@@ -24,9 +24,6 @@
 #include "sst/core/warnmacros.h"
 
 #ifdef SST_CONFIG_HAVE_MPI
-DISABLE_WARN_MISSING_OVERRIDE
-#include <mpi.h>
-REENABLE_WARNING
 #define UNUSED_WO_MPI(x) x
 #else
 #define UNUSED_WO_MPI(x) UNUSED(x)
@@ -53,15 +50,23 @@ SimTime_t RankSyncSerialSkip::myNextSyncTime = 0;
 
 RankSyncSerialSkip::RankSyncSerialSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
     RankSync(num_ranks),
+    lookahead(MAX_SIMTIME_T),
+    reduce_pending(false),
+    reduce_input(0),
+    reduce_output(0),
     mpiWaitTime(0.0),
     deserializeTime(0.0)
 {
     max_period     = Simulation_impl::getSimulation()->getMinPartTC();
     myNextSyncTime = max_period->getFactor();
+    adaptive       = Simulation_impl::getSimulation()->adaptive_rank_sync;
+    nonblocking    = Simulation_impl::getSimulation()->nonblocking_rank_sync;
 }
 
 RankSyncSerialSkip::~RankSyncSerialSkip()
 {
+    waitForPending();
+
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
         delete i->second.squeue;
     }
@@ -85,11 +90,17 @@ RankSyncSerialSkip::registerLink(
         comm_map[to_rank.rank].rbuf           = new char[4096];
         comm_map[to_rank.rank].local_size     = 4096;
         comm_map[to_rank.rank].remote_size    = 4096;
+        comm_map[to_rank.rank].min_latency    = MAX_SIMTIME_T;
     }
     else {
         queue = comm_map[to_rank.rank].squeue;
     }
 
+    // Latency can only grow after the link is registered, so this is
+    // a safe lower bound
+    SimTime_t latency = getSendLatency(link);
+    if ( latency < comm_map[to_rank.rank].min_latency ) comm_map[to_rank.rank].min_latency = latency;
+
     link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     link->setSendingComponentInfo("SYNC", "SYNC", "");
@@ -99,11 +110,65 @@ RankSyncSerialSkip::registerLink(
 
 void
 RankSyncSerialSkip::finalizeLinkConfigurations()
-{}
+{
+    for ( auto& x : comm_map ) {
+        if ( x.second.min_latency < lookahead ) lookahead = x.second.min_latency;
+    }
+}
 
 void
 RankSyncSerialSkip::prepareForComplete()
-{}
+{
+    // The untimed exchanges reuse the send buffers
+    waitForPending();
+}
+
+void
+RankSyncSerialSkip::waitForPending()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( reduce_pending ) {
+        MPI_Wait(&reduce_req, MPI_STATUS_IGNORE);
+        reduce_pending = false;
+    }
+    if ( !send_reqs.empty() ) {
+        MPI_Waitall(send_reqs.size(), send_reqs.data(), MPI_STATUSES_IGNORE);
+        send_reqs.clear();
+    }
+#endif
+}
+
+SimTime_t
+RankSyncSerialSkip::getNextSyncInput()
+{
+    // Need to get the local minimum, then do a global minimum
+    // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
+    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
+
+    if ( adaptive ) {
+        // Nothing this rank does can reach another rank before its
+        // next activity plus its own lookahead, so reduce on that
+        // instead.  The smallest result is the earliest time any
+        // event can cross a rank boundary, which is when we next need
+        // to sync.  A rank with no links to other ranks, or nothing
+        // left to do, places no bound on the sync.
+        if ( input != MAX_SIMTIME_T && lookahead != MAX_SIMTIME_T ) { input += lookahead; }
+        else {
+            input = MAX_SIMTIME_T;
+        }
+    }
+    return input;
+}
+
+SimTime_t
+RankSyncSerialSkip::getNextSyncTimeFromReduction(SimTime_t reduced, SimTime_t current_cycle)
+{
+    if ( !adaptive ) return reduced + max_period->getFactor();
+
+    // Fall back to the fixed period if no rank can send anything
+    if ( reduced != MAX_SIMTIME_T ) return reduced;
+    return current_cycle + max_period->getFactor();
+}
 
 uint64_t
 RankSyncSerialSkip::getDataSize() const
@@ -126,14 +191,42 @@ RankSyncSerialSkip::exchange(void)
 {
 #ifdef SST_CONFIG_HAVE_MPI
 
+    Simulation_impl* sim           = Simulation_impl::getSimulation();
+    SimTime_t        current_cycle = sim->getCurrentSimCycle();
+
+    exit_state_reduced = false;
+
+    if ( reduce_pending ) {
+        // Finish the reduction started at the last exchange.  If it
+        // shows that no event can cross a rank boundary yet, every
+        // rank skips the exchange and moves the sync out.
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Wait(&reduce_req, MPI_STATUS_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        reduce_pending = false;
+
+        SimTime_t next = getNextSyncTimeFromReduction(reduce_output, current_cycle);
+        if ( next > current_cycle ) {
+            myNextSyncTime = next;
+            return;
+        }
+    }
+
+    // The send buffers are reused, so sends left in flight by the
+    // last exchange have to finish first
+    if ( !send_reqs.empty() ) {
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Waitall(send_reqs.size(), send_reqs.data(), MPI_STATUSES_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        send_reqs.clear();
+    }
+
     // Maximum number of outstanding requests is 3 times the number
     // of ranks I communicate with (1 recv, 2 sends per rank)
-    MPI_Request sreqs[2 * comm_map.size()];
     MPI_Request rreqs[comm_map.size()];
-    int         sreq_count = 0;
     int         rreq_count = 0;
-
-    Simulation_impl* sim = Simulation_impl::getSimulation();
+    int         sreq_count = 0;
+    send_reqs.resize(2 * comm_map.size());
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
@@ -155,7 +248,7 @@ RankSyncSerialSkip::exchange(void)
             hdr->mode = 1;
             MPI_Isend(
                 send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
+                &send_reqs[sreq_count++]);
             i->second.remote_size = hdr->buffer_size;
             tag                   = 2;
         }
@@ -163,15 +256,15 @@ RankSyncSerialSkip::exchange(void)
             hdr->mode = 0;
         }
         MPI_Isend(
-            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &send_reqs[sreq_count++]);
 
         // Post all the receives
         MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
     }
 
-    // Wait for all sends and recvs to complete
-    SimTime_t current_cycle = sim->getCurrentSimCycle();
+    send_reqs.resize(sreq_count);
 
+    // Wait for all recvs to complete
     auto waitStart = SST::Core::Profile::now();
     MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
     mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
@@ -216,29 +309,38 @@ RankSyncSerialSkip::exchange(void)
         activities.clear();
     }
 
-    // Clear the SyncQueues used to send the data after all the sends have completed
-    waitStart = SST::Core::Profile::now();
-    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
-    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    if ( !nonblocking ) {
+        // Clear the SyncQueues used to send the data after all the sends have completed
+        waitStart = SST::Core::Profile::now();
+        MPI_Waitall(send_reqs.size(), send_reqs.data(), MPI_STATUSES_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        send_reqs.clear();
+    }
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
         i->second.squeue->clear();
     }
 
-    // If we have an Exit object, fire it to see if we need end simulation
-    // if ( exit != nullptr ) exit->check();
-
     // Check to see when the next event is scheduled, then do an
     // all_reduce with min operator and set next sync time to be
     // min + max_period.
+    reduce_input = getNextSyncInput();
+
+    if ( nonblocking ) {
+        // Leave the reduction running through the next window.  Nothing
+        // sent in the window can arrive before one period from now, so
+        // that is always a safe time for the next sync.
+        MPI_Iallreduce(&reduce_input, &reduce_output, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req);
+        reduce_pending = true;
+        myNextSyncTime = current_cycle + max_period->getFactor();
+        return;
+    }
 
-    // Need to get the local minimum, then do a global minimum
-    // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
-    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    // Reduce the exit state along with the next sync time so the sync
+    // needs only one collective
+    reduce_output = reduceSyncValues(reduce_input);
 
-    myNextSyncTime = min_time + max_period->getFactor();
+    myNextSyncTime = getNextSyncTimeFromReduction(reduce_output, current_cycle);
 #endif
 }
 
@@ -15,8 +15,16 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/sync/syncManager.h"
 #include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
 
 #include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
 
 namespace SST {
 
@@ -52,12 +60,22 @@ private:
     // Function that actually does the exchange during run
     void exchange();
 
+    // Compute the value this rank contributes to the next sync time
+    // reduction
+    SimTime_t getNextSyncInput();
+    // Turn the result of the next sync time reduction into the next
+    // sync time
+    SimTime_t getNextSyncTimeFromReduction(SimTime_t reduced, SimTime_t current_cycle);
+    // Complete any outstanding nonblocking operations
+    void      waitForPending();
+
     struct comm_pair
     {
         SyncQueue* squeue; // SyncQueue
         char*      rbuf;   // receive buffer
         uint32_t   local_size;
         uint32_t   remote_size;
+        SimTime_t  min_latency; // Smallest latency of links to this rank
     };
 
     typedef std::map<int, comm_pair>         comm_map_t;
@@ -67,6 +85,26 @@ private:
     comm_map_t comm_map;
     link_map_t link_map;
 
+    // When adaptive, the next sync is computed from each rank's own
+    // lookahead (the smallest latency of its links to other ranks)
+    // instead of the global minimum partition latency
+    bool      adaptive;
+    SimTime_t lookahead;
+
+    // When nonblocking, the next sync time reduction and the sends
+    // are left in flight while the next window executes.  The next
+    // sync is conservatively scheduled one period out; if the
+    // reduction shows that nothing can cross a rank boundary by then,
+    // that sync skips the exchange and reschedules itself.
+    bool nonblocking;
+    bool reduce_pending;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Request              reduce_req;
+    std::vector<MPI_Request> send_reqs;
+#endif
+    SimTime_t reduce_input;
+    SimTime_t reduce_output;
+
     double mpiWaitTime;
     double deserializeTime;
 
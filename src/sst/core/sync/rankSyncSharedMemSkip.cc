@@ -0,0 +1,369 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncSharedMemSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <cstring>
+#include <thread>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+// Static Data Members
+SimTime_t RankSyncSharedMemSkip::myNextSyncTime = 0;
+
+// Initial number of bytes of event data each region can hold.  A
+// region is replaced with a larger one when the data outgrows it.
+static const size_t initial_capacity = 64 * 1024;
+
+// Number of notices that can be in a circular buffer.  There is
+// never more than one outstanding.
+static const size_t notice_queue_size = 4;
+
+// Back off while waiting on another rank, since ranks may be
+// oversubscribed on the node
+static inline void
+shmemWait(uint32_t& count)
+{
+    if ( count++ < 1024 ) { sst_pause(); }
+    else {
+        std::this_thread::yield();
+    }
+}
+
+RankSyncSharedMemSkip::RankSyncSharedMemSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
+    RankSync(num_ranks),
+    reduce_tunnel(nullptr),
+    reduce_generation(0),
+    connected(false),
+    shmWaitTime(0.0),
+    deserializeTime(0.0)
+{
+    max_period     = Simulation_impl::getSimulation()->getMinPartTC();
+    myNextSyncTime = max_period->getFactor();
+}
+
+RankSyncSharedMemSkip::~RankSyncSharedMemSkip()
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        delete i->second.squeue;
+        delete i->second.send_tunnel;
+        delete i->second.old_send_tunnel;
+        delete i->second.recv_tunnel;
+    }
+    comm_map.clear();
+    delete reduce_tunnel;
+
+    if ( shmWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "RankSyncSharedMemSkip shmWait: %lg sec  deserializeWait:  %lg sec\n", shmWaitTime,
+            deserializeTime);
+}
+
+bool
+RankSyncSharedMemSkip::allRanksOnNode()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+
+    int node_size;
+    int world_size;
+    MPI_Comm_size(node_comm, &node_size);
+    MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+    MPI_Comm_free(&node_comm);
+
+    return node_size == world_size;
+#else
+    return false;
+#endif
+}
+
+ActivityQueue*
+RankSyncSharedMemSkip::registerLink(
+    const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), const std::string& name, Link* link)
+{
+    std::lock_guard<Core::ThreadSafe::Spinlock> slock(lock);
+
+    SyncQueue* queue;
+    if ( comm_map.count(to_rank.rank) == 0 ) {
+        comm_pair& pair      = comm_map[to_rank.rank];
+        queue = pair.squeue  = new SyncQueue();
+        pair.send_tunnel     = nullptr;
+        pair.old_send_tunnel = nullptr;
+        pair.send_capacity   = 0;
+        pair.sent            = 0;
+        pair.recv_tunnel     = nullptr;
+        pair.received        = 0;
+    }
+    else {
+        queue = comm_map[to_rank.rank].squeue;
+    }
+
+    link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncSharedMemSkip::connect()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    uint32_t my_rank = Simulation_impl::getSimulation()->getRank().rank;
+
+    // Create the regions this rank writes into
+    for ( auto& x : comm_map ) {
+        x.second.send_capacity = initial_capacity;
+        x.second.send_tunnel   = new tunnel_t(my_rank, 1, notice_queue_size, 1, initial_capacity);
+    }
+
+    // Links always come in pairs, so the ranks this rank sends to are
+    // the same ranks it receives from.  Swap region names with them.
+    const int         name_size = sizeof(Mailbox::next_region);
+    std::vector<char> send_names(comm_map.size() * name_size, '\0');
+    std::vector<char> recv_names(comm_map.size() * name_size, '\0');
+    MPI_Request       reqs[2 * comm_map.size()];
+    int               index = 0;
+    for ( auto& x : comm_map ) {
+        strncpy(&send_names[index * name_size], x.second.send_tunnel->getRegionName().c_str(), name_size - 1);
+        MPI_Isend(&send_names[index * name_size], name_size, MPI_CHAR, x.first, 3, MPI_COMM_WORLD, &reqs[2 * index]);
+        MPI_Irecv(
+            &recv_names[index * name_size], name_size, MPI_CHAR, x.first, 3, MPI_COMM_WORLD, &reqs[2 * index + 1]);
+        index++;
+    }
+    MPI_Waitall(2 * index, reqs, MPI_STATUSES_IGNORE);
+
+    index = 0;
+    for ( auto& x : comm_map ) {
+        x.second.recv_tunnel = new tunnel_t(std::string(&recv_names[index * name_size]));
+        index++;
+    }
+
+    // Rank 0 creates the region used for reductions, with two sets of
+    // slots so that one reduction can start before every rank has
+    // finished reading the last one
+    char reduce_name[name_size];
+    memset(reduce_name, '\0', name_size);
+    if ( my_rank == 0 ) {
+        reduce_tunnel =
+            new reduce_tunnel_t(my_rank, 0, 0, num_ranks.rank - 1, 2 * num_ranks.rank * sizeof(ReduceSlot));
+        reduce_tunnel->getSharedData()->num_ranks = num_ranks.rank;
+        strncpy(reduce_name, reduce_tunnel->getRegionName().c_str(), name_size - 1);
+    }
+    MPI_Bcast(reduce_name, name_size, MPI_CHAR, 0, MPI_COMM_WORLD);
+    if ( my_rank != 0 ) { reduce_tunnel = new reduce_tunnel_t(std::string(reduce_name)); }
+#endif
+    connected = true;
+}
+
+uint64_t
+RankSyncSharedMemSkip::getDataSize() const
+{
+    size_t count = 0;
+    for ( comm_map_t::const_iterator it = comm_map.begin(); it != comm_map.end(); ++it ) {
+        count += (it->second.squeue->getDataSize() + it->second.send_capacity);
+    }
+    return count;
+}
+
+void
+RankSyncSharedMemSkip::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncSharedMemSkip::send(comm_pair& pair)
+{
+    Mailbox* mbox = pair.send_tunnel->getSharedData();
+
+    // The receiver unpacks straight out of the region, so wait until
+    // it is done with the last exchange
+    auto     waitStart = SST::Core::Profile::now();
+    uint32_t count     = 0;
+    while ( mbox->consumed != pair.sent ) {
+        shmemWait(count);
+    }
+    __sync_synchronize();
+    shmWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    // Once the receiver has consumed from the new region, it is done
+    // with the old one
+    if ( pair.old_send_tunnel ) {
+        delete pair.old_send_tunnel;
+        pair.old_send_tunnel = nullptr;
+    }
+
+    Notice notice;
+    notice.moved = 0;
+    if ( !pair.squeue->getData(mbox->data(), pair.send_capacity, notice.size) ) {
+        // Doesn't fit.  Move to a larger region and tell the receiver
+        // where to find it through the current one.
+        size_t capacity = pair.send_capacity;
+        while ( capacity < notice.size ) {
+            capacity *= 2;
+        }
+        uint32_t  my_rank = Simulation_impl::getSimulation()->getRank().rank;
+        tunnel_t* tunnel  = new tunnel_t(my_rank, 1, notice_queue_size, 1, capacity);
+        pair.squeue->getData(tunnel->getSharedData()->data(), capacity, notice.size);
+
+        memset(mbox->next_region, '\0', sizeof(mbox->next_region));
+        strncpy(mbox->next_region, tunnel->getRegionName().c_str(), sizeof(mbox->next_region) - 1);
+        notice.moved = 1;
+        pair.send_tunnel->writeMessage(0, notice);
+
+        pair.old_send_tunnel = pair.send_tunnel;
+        pair.send_tunnel     = tunnel;
+        pair.send_capacity   = capacity;
+    }
+    else {
+        pair.send_tunnel->writeMessage(0, notice);
+    }
+    pair.sent++;
+}
+
+void
+RankSyncSharedMemSkip::receive(comm_pair& pair, std::vector<Activity*>& activities)
+{
+    // Blocks until the sender's data is in place
+    auto   waitStart = SST::Core::Profile::now();
+    Notice notice    = pair.recv_tunnel->readMessage(0);
+    shmWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    if ( notice.moved ) {
+        tunnel_t* tunnel = new tunnel_t(std::string(pair.recv_tunnel->getSharedData()->next_region));
+        delete pair.recv_tunnel;
+        pair.recv_tunnel = tunnel;
+    }
+
+    Mailbox* mbox = pair.recv_tunnel->getSharedData();
+
+    auto deserialStart = SST::Core::Profile::now();
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(mbox->data(), notice.size);
+    ser& activities;
+
+    deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+    // Let the sender reuse the region
+    __sync_synchronize();
+    mbox->consumed = ++pair.received;
+}
+
+uint64_t
+RankSyncSharedMemSkip::reduce(uint64_t value, bool sum)
+{
+    uint64_t    gen     = ++reduce_generation;
+    uint32_t    my_rank = Simulation_impl::getSimulation()->getRank().rank;
+    ReduceSlot* slots   = reduce_tunnel->getSharedData()->slots() + (gen % 2) * num_ranks.rank;
+
+    // A rank can't get two reductions ahead of any other, so the slots
+    // for this reduction can't be overwritten while they are read
+    slots[my_rank].value = value;
+    __sync_synchronize();
+    slots[my_rank].generation = gen;
+
+    auto     waitStart = SST::Core::Profile::now();
+    uint64_t result    = sum ? 0 : MAX_SIMTIME_T;
+    for ( uint32_t r = 0; r < num_ranks.rank; r++ ) {
+        uint32_t count = 0;
+        while ( slots[r].generation != gen ) {
+            shmemWait(count);
+        }
+        __sync_synchronize();
+        if ( sum ) { result += slots[r].value; }
+        else if ( slots[r].value < result ) {
+            result = slots[r].value;
+        }
+    }
+    shmWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    return result;
+}
+
+void
+RankSyncSharedMemSkip::exchange(void)
+{
+    if ( !connected ) connect();
+
+    Simulation_impl* sim           = Simulation_impl::getSimulation();
+    SimTime_t        current_cycle = sim->getCurrentSimCycle();
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        send(i->second);
+    }
+
+    std::vector<Activity*> activities;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        receive(i->second, activities);
+
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event*    ev    = static_cast<Event*>(activities[j]);
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            getDeliveryLink(ev)->send(delay, ev);
+        }
+
+        activities.clear();
+    }
+
+    // Check to see when the next event is scheduled, then do a global
+    // minimum and set next sync time to be min + max_period.
+    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
+    myNextSyncTime  = reduce(input, false) + max_period->getFactor();
+}
+
+void
+RankSyncSharedMemSkip::exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count)
+{
+    if ( thread != 0 ) { return; }
+    if ( !connected ) connect();
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        send(i->second);
+    }
+
+    std::vector<Activity*> activities;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        receive(i->second, activities);
+
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event* ev = static_cast<Event*>(activities[j]);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+
+        activities.clear();
+    }
+
+    // See if there were any messages sent
+    msg_count = reduce(msg_count, true);
+}
+
+} // namespace SST
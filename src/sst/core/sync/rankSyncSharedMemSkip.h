@@ -0,0 +1,151 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCSHAREDMEMSKIP_H
+#define SST_CORE_SYNC_RANKSYNCSHAREDMEMSKIP_H
+
+#include "sst/core/interprocess/ipctunnel.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/threadsafe.h"
+
+#include <map>
+#include <vector>
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * RankSync for ranks that all share a node.
+ *
+ * Each rank serializes the events for another rank directly into a
+ * shared memory region (an IPCTunnel) that the receiving rank has
+ * mapped, and the receiver deserializes straight out of it, so the
+ * data is never copied between the two.  A small circular buffer in
+ * the same region tells the receiver when the data is ready.  The
+ * next sync time reduction is done through a second region shared by
+ * all ranks.  MPI is only used to swap the region names when the
+ * regions are set up.
+ *
+ * Only used with one thread per rank.
+ */
+class RankSyncSharedMemSkip : public RankSync
+{
+public:
+    /** Create a new Sync object which fires with a specified period */
+    RankSyncSharedMemSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncSharedMemSkip();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override {}
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override {}
+
+    SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+
+    uint64_t getDataSize() const override;
+
+    /** Check whether all the ranks are on the same node and can
+     * therefore share memory */
+    static bool allRanksOnNode();
+
+private:
+    // Shared by the sending and receiving rank.  The serialized
+    // events follow it directly in the region.
+    struct Mailbox
+    {
+        // Number of exchanges the receiver has finished unpacking
+        volatile uint64_t consumed;
+        // Set by the sender when the data outgrows the region
+        char              next_region[64];
+
+        // The serialized events, which start right after the struct
+        char* data() { return reinterpret_cast<char*>(this + 1); }
+    };
+
+    // Sent through the circular buffer once the data is in place
+    struct Notice
+    {
+        uint64_t size;
+        uint32_t moved; // Data is in the region named by next_region
+    };
+
+    typedef Core::Interprocess::IPCTunnel<Mailbox, Notice> tunnel_t;
+
+    // One slot per rank in the reduction region, each in its own
+    // cache line
+    struct ReduceSlot
+    {
+        volatile uint64_t generation;
+        volatile uint64_t value;
+        char              pad[48];
+    };
+
+    struct ReduceRegion
+    {
+        uint64_t num_ranks;
+
+        // The 2 * num_ranks slots, which start right after the struct
+        ReduceSlot* slots() { return reinterpret_cast<ReduceSlot*>(this + 1); }
+    };
+
+    typedef Core::Interprocess::IPCTunnel<ReduceRegion, uint64_t> reduce_tunnel_t;
+
+    static SimTime_t myNextSyncTime;
+
+    struct comm_pair
+    {
+        SyncQueue* squeue;          // SyncQueue
+        tunnel_t*  send_tunnel;     // Region this rank writes into
+        tunnel_t*  old_send_tunnel; // Region being replaced, until the receiver moves off of it
+        size_t     send_capacity;   // Bytes available for data in send_tunnel
+        uint64_t   sent;            // Number of exchanges sent
+        tunnel_t*  recv_tunnel;     // Region the remote rank writes into
+        uint64_t   received;        // Number of exchanges received
+    };
+
+    // Create the regions and attach to the other ranks' regions
+    void     connect();
+    // Function that actually does the exchange during run
+    void     exchange();
+    // Serialize the queued events for a rank into its region
+    void     send(comm_pair& pair);
+    // Deserialize the events sent by a rank
+    void     receive(comm_pair& pair, std::vector<Activity*>& activities);
+    // Reduce value across all ranks, either a minimum or a sum
+    uint64_t reduce(uint64_t value, bool sum);
+
+    typedef std::map<int, comm_pair> comm_map_t;
+
+    comm_map_t comm_map;
+
+    reduce_tunnel_t* reduce_tunnel;
+    uint64_t         reduce_generation;
+    bool             connected;
+
+    double shmWaitTime;
+    double deserializeTime;
+
+    Core::ThreadSafe::Spinlock lock;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCSHAREDMEMSKIP_H
@@ -19,12 +19,14 @@
 #include "sst/core/simulation_impl.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/sync/rankSyncSharedMemSkip.h"
 #include "sst/core/sync/threadSyncDirectSkip.h"
 #include "sst/core/sync/threadSyncQueue.h"
 #include "sst/core/sync/threadSyncSimpleSkip.h"
 #include "sst/core/timeConverter.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <sys/time.h>
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -39,10 +41,12 @@ REENABLE_WARNING
 namespace SST {
 
 // Static data members
-RankSync*                 SyncManager::rankSync = nullptr;
-Core::ThreadSafe::Barrier SyncManager::RankExecBarrier[6];
-Core::ThreadSafe::Barrier SyncManager::LinkUntimedBarrier[3];
-SimTime_t                 SyncManager::next_rankSync = MAX_SIMTIME_T;
+RankSync*                     SyncManager::rankSync = nullptr;
+Core::ThreadSafe::TreeBarrier SyncManager::RankExecBarrier[2];
+Core::ThreadSafe::TreeBarrier SyncManager::ThreadExecBarrier;
+Core::ThreadSafe::TreeBarrier SyncManager::LinkUntimedBarrier;
+SimTime_t                     SyncManager::next_rankSync      = MAX_SIMTIME_T;
+SimTime_t                     SyncManager::next_activity_time = MAX_SIMTIME_T;
 
 #if SST_SYNC_PROFILING
 
@@ -207,8 +211,61 @@ RankSync::exchangeLinkInfo(uint32_t UNUSED_WO_MPI(my_rank))
 #endif
 }
 
+#ifdef SST_CONFIG_HAVE_MPI
+namespace {
+// Values combined across ranks at each sync
+struct SyncValues
+{
+    SimTime_t next_time; // Reduced with min
+    SimTime_t end_time;  // Reduced with max
+    uint64_t  active;    // Ranks whose primary components are not done, reduced with sum
+};
+
+void
+reduceSyncValuesOp(void* in, void* inout, int* len, MPI_Datatype* UNUSED(type))
+{
+    SyncValues* a = static_cast<SyncValues*>(in);
+    SyncValues* b = static_cast<SyncValues*>(inout);
+    for ( int i = 0; i < *len; ++i ) {
+        b[i].next_time = std::min(a[i].next_time, b[i].next_time);
+        b[i].end_time  = std::max(a[i].end_time, b[i].end_time);
+        b[i].active += a[i].active;
+    }
+}
+} // anonymous namespace
+#endif
+
+SimTime_t
+RankSync::reduceSyncValues(SimTime_t next_time)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    static MPI_Datatype values_type = MPI_DATATYPE_NULL;
+    static MPI_Op       values_op   = MPI_OP_NULL;
+    if ( values_type == MPI_DATATYPE_NULL ) {
+        MPI_Type_contiguous(3, MPI_UINT64_T, &values_type);
+        MPI_Type_commit(&values_type);
+        MPI_Op_create(&reduceSyncValuesOp, 1 /* commutative */, &values_op);
+    }
+
+    Exit*      exit = Simulation_impl::getSimulation()->getExit();
+    SyncValues input;
+    SyncValues output;
+    input.next_time = next_time;
+    input.end_time  = exit->getEndTime();
+    input.active    = exit->getRefCount() > 0;
+
+    MPI_Allreduce(&input, &output, 1, values_type, values_op, MPI_COMM_WORLD);
+
+    exit->setGlobalState(output.active, output.end_time);
+    exit_state_reduced = true;
+    return output.next_time;
+#else
+    return next_time;
+#endif
+}
+
 // Class used to hold the list of profile tools installed in the SyncManager
-class SyncProfileToolList
+class SyncProfileToolList : public Core::ThreadSafe::BarrierWaitListener
 {
 public:
     SyncProfileToolList() {}
@@ -225,14 +282,25 @@ public:
             x->syncManagerEnd();
     }
 
+    void barrierWait(const char* barrier, uint64_t wait_time) override
+    {
+        for ( auto* x : barrier_tools )
+            x->syncBarrierWait(barrier, wait_time);
+    }
+
     /**
        Adds a profile tool the the list and registers this handler
        with the profile tool
     */
-    void addProfileTool(Profile::SyncProfileTool* tool) { tools.push_back(tool); }
+    void addProfileTool(Profile::SyncProfileTool* tool)
+    {
+        tools.push_back(tool);
+        if ( tool->recordsBarrierWaits() ) barrier_tools.push_back(tool);
+    }
 
 private:
     std::vector<Profile::SyncProfileTool*> tools;
+    std::vector<Profile::SyncProfileTool*> barrier_tools;
 };
 
 
@@ -251,11 +319,32 @@ SyncManager::SyncManager(
         for ( auto& b : RankExecBarrier ) {
             b.resize(num_ranks.thread);
         }
-        for ( auto& b : LinkUntimedBarrier ) {
-            b.resize(num_ranks.thread);
-        }
+        ThreadExecBarrier.resize(num_ranks.thread);
+        LinkUntimedBarrier.resize(num_ranks.thread);
+        RankExecBarrier[0].setName("rank_sync.arrive");
+        RankExecBarrier[1].setName("rank_sync.release");
+        ThreadExecBarrier.setName("thread_sync.exit_check");
+        LinkUntimedBarrier.setName("untimed_data.release");
         if ( min_part != MAX_SIMTIME_T ) {
-            if ( num_ranks.thread == 1 ) { rankSync = new RankSyncSerialSkip(num_ranks, minPartTC); }
+            bool use_shmem = false;
+            if ( sim->shmem_rank_sync ) {
+                use_shmem = num_ranks.thread == 1 && RankSyncSharedMemSkip::allRanksOnNode();
+                if ( !use_shmem && rank.rank == 0 ) {
+                    sim->getSimulationOutput().output(
+                        "WARNING: shared memory rank sync needs one thread per rank and all ranks on one node, using "
+                        "MPI instead\n");
+                }
+                if ( use_shmem && rank.rank == 0 && (sim->adaptive_rank_sync || sim->nonblocking_rank_sync) ) {
+                    sim->getSimulationOutput().output(
+                        "WARNING: --adaptive-rank-sync and --nonblocking-rank-sync are not supported by the shared "
+                        "memory rank sync and will be ignored\n");
+                }
+            }
+
+            if ( use_shmem ) { rankSync = new RankSyncSharedMemSkip(num_ranks, minPartTC); }
+            else if ( num_ranks.thread == 1 ) {
+                rankSync = new RankSyncSerialSkip(num_ranks, minPartTC);
+            }
             else {
                 rankSync = new RankSyncParallelSkip(num_ranks, minPartTC);
             }
@@ -286,7 +375,11 @@ SyncManager::SyncManager(
     setPriority(SYNCPRIORITY);
 }
 
-SyncManager::~SyncManager() {}
+SyncManager::~SyncManager()
+{
+    if ( Core::ThreadSafe::BarrierWaitListener::getListener() == profile_tools )
+        Core::ThreadSafe::BarrierWaitListener::setListener(nullptr);
+}
 
 /** Register a Link which this Sync Object is responsible for */
 ActivityQueue*
@@ -333,7 +426,7 @@ SyncManager::execute(void)
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
         // queues.
-        RankExecBarrier[0].wait();
+        RankExecBarrier[0].wait(rank.thread);
 
         // For a rank sync, we will force a thread sync first.  This
         // will ensure that all events sent between threads will be
@@ -341,26 +434,34 @@ SyncManager::execute(void)
         // this to enable any skip ahead optimizations.
         threadSync->before();
 
-        // Need to make sure everyone has made it through the mutex
-        // and the min time computation is complete
-        RankExecBarrier[1].wait();
-
-        // Now call the actual RankSync
-        rankSync->execute(rank.thread);
-
-        RankExecBarrier[2].wait();
-
-        // Now call the threadSync after() call
-        threadSync->after();
-
-        RankExecBarrier[3].wait();
-
-        if ( exit != nullptr && rank.thread == 0 ) exit->check();
+        // Thread 0 waits for everyone to finish the thread sync, then
+        // does the rank sync and everything else that needs the other
+        // threads held before releasing them.  The other threads only
+        // take part in the rank sync if it uses them
+        // (RankSyncParallelSkip), otherwise execute() returns right
+        // away and they just wait for the release.
+        if ( RankExecBarrier[1].arrive(rank.thread) ) {
+            rankSync->execute(rank.thread);
+
+            // The rank sync may already have reduced the exit state
+            // along with the next sync time
+            if ( exit != nullptr && !rankSync->reducedExitState() ) exit->check();
+
+            next_activity_time = sim->getLocalMinimumNextActivityTime();
+            RankExecBarrier[1].release();
+        }
+        else {
+            rankSync->execute(rank.thread);
+            RankExecBarrier[1].waitForRelease(rank.thread);
+        }
 
-        RankExecBarrier[4].wait();
+        // Nothing below reads state that another thread can change
+        // before the next sync, so there is no barrier on the way out
+        threadSync->afterRankSync(next_activity_time);
 
         if ( exit->getGlobalCount() == 0 ) { endSimulation(exit->getEndTime()); }
 
+        computeNextInsert();
         break;
     case THREAD:
 
@@ -370,12 +471,15 @@ SyncManager::execute(void)
             if ( exit->getRefCount() == 0 ) { endSimulation(exit->getEndTime()); }
         }
 
+        computeNextInsert();
+
+        // All threads have to read the ref count before any of them
+        // can run events that change it
+        ThreadExecBarrier.wait(rank.thread);
         break;
     default:
         break;
     }
-    computeNextInsert();
-    RankExecBarrier[5].wait();
 
     if ( profile_tools ) profile_tools->syncManagerEnd();
 
@@ -386,11 +490,17 @@ SyncManager::execute(void)
 void
 SyncManager::exchangeLinkUntimedData(std::atomic<int>& msg_count)
 {
-    LinkUntimedBarrier[0].wait();
+    // The callers hold all threads at a barrier before and after this
+    // call, so only the rank exchange on thread 0 has to wait for the
+    // other threads to finish with their thread queues
     threadSync->processLinkUntimedData();
-    LinkUntimedBarrier[1].wait();
-    rankSync->exchangeLinkUntimedData(rank.thread, msg_count);
-    LinkUntimedBarrier[2].wait();
+    if ( LinkUntimedBarrier.arrive(rank.thread) ) {
+        rankSync->exchangeLinkUntimedData(rank.thread, msg_count);
+        LinkUntimedBarrier.release();
+    }
+    else {
+        LinkUntimedBarrier.waitForRelease(rank.thread);
+    }
 }
 
 /** Finish link configuration */
@@ -447,6 +557,10 @@ SyncManager::addProfileTool(Profile::SyncProfileTool* tool)
 {
     if ( !profile_tools ) profile_tools = new SyncProfileToolList();
     profile_tools->addProfileTool(tool);
+
+    // Tools are added on the thread that owns this SyncManager, which
+    // is the thread whose barrier waits get reported
+    if ( tool->recordsBarrierWaits() ) Core::ThreadSafe::BarrierWaitListener::setListener(profile_tools);
 }
 
 } // namespace SST
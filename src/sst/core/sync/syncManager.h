@@ -57,10 +57,24 @@ public:
 
     virtual uint64_t getDataSize() const = 0;
 
+    /** True if the last execute() also reduced the exit state across
+     * ranks, so Exit::check() does not need its own reduction */
+    bool reducedExitState() const { return exit_state_reduced; }
+
 protected:
     SimTime_t      nextSyncTime;
     TimeConverter* max_period;
     const RankInfo num_ranks;
+    bool           exit_state_reduced = false;
+
+    /** Reduce the next activity time across ranks together with the
+     * exit state (whether each rank's primary components are done and
+     * when), so a sync needs a single collective.  The exit state is
+     * passed on to Exit.
+     * @param next_time This rank's contribution to the next sync time
+     * @return The minimum next_time across ranks
+     */
+    SimTime_t reduceSyncValues(SimTime_t next_time);
 
     std::vector<std::map<std::string, uintptr_t>> link_maps;
 
@@ -74,6 +88,11 @@ protected:
 
     inline Link* getDeliveryLink(Event* ev) { return ev->getDeliveryLink(); }
 
+    /** Get the latency events sent into the sync on this link will
+     * see.  This is a lower bound on how far in the future any event
+     * sent on the link will be delivered. */
+    inline SimTime_t getSendLatency(Link* link) { return link->pair_link->latency; }
+
 private:
 };
 
@@ -86,6 +105,15 @@ public:
     virtual void before()                     = 0;
     virtual void after()                      = 0;
     virtual void execute()                    = 0;
+    /**
+       Same as after(), but called at a rank sync with the minimum
+       next activity time of this rank, which SyncManager computes
+       once while all of the threads are held.  Implementations that
+       need that time should use this value instead of reading the
+       other threads' TimeVortices, since those threads may already be
+       running again.
+     */
+    virtual void afterRankSync(SimTime_t /* next_activity_time */) { after(); }
     virtual void processLinkUntimedData()     = 0;
     virtual void finalizeLinkConfigurations() = 0;
     virtual void prepareForComplete()         = 0;
@@ -147,8 +175,10 @@ private:
 
     RankInfo                         rank;
     RankInfo                         num_ranks;
-    static Core::ThreadSafe::Barrier RankExecBarrier[6];
-    static Core::ThreadSafe::Barrier LinkUntimedBarrier[3];
+    static Core::ThreadSafe::TreeBarrier RankExecBarrier[2];
+    static Core::ThreadSafe::TreeBarrier ThreadExecBarrier;
+    static Core::ThreadSafe::TreeBarrier LinkUntimedBarrier;
+    static SimTime_t                     next_activity_time;
     // static SimTime_t min_next_time;
     // static int min_count;
 
@@ -32,7 +32,7 @@ namespace SST {
 using namespace Core::ThreadSafe;
 using namespace Core::Serialization;
 
-SyncQueue::SyncQueue() : ActivityQueue(), buffer(nullptr), buf_size(0) {}
+SyncQueue::SyncQueue() : ActivityQueue() {}
 
 SyncQueue::~SyncQueue() {}
 
@@ -90,7 +90,8 @@ SyncQueue::getData()
 
     serializer ser;
 
-    ser.start_sizing();
+    // Serialize straight into the buffer, leaving room for the header
+    ser.start_packing(buffer, sizeof(SyncQueue::Header));
 
     ser& activities;
 
@@ -98,17 +99,6 @@ SyncQueue::getData()
 
     SST_EVENT_PROFILE_SIZE(activities.size(), size)
 
-    if ( buf_size < (size + sizeof(SyncQueue::Header)) ) {
-        if ( buffer != nullptr ) { delete[] buffer; }
-
-        buf_size = size + sizeof(SyncQueue::Header);
-        buffer   = new char[buf_size];
-    }
-
-    ser.start_packing(buffer + sizeof(SyncQueue::Header), size);
-
-    ser& activities;
-
     // Delete all the events
     for ( unsigned int i = 0; i < activities.size(); i++ ) {
         delete activities[i];
@@ -116,9 +106,37 @@ SyncQueue::getData()
     activities.clear();
 
     // Set the size field in the header
-    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(SyncQueue::Header);
+    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer.data()))->buffer_size = size + sizeof(SyncQueue::Header);
+
+    return buffer.data();
+}
+
+bool
+SyncQueue::getData(char* dest, size_t max_size, size_t& size)
+{
+    std::lock_guard<Spinlock> lock(slock);
+
+    serializer ser;
+    ser.start_packing(dest, max_size);
+    try {
+        ser& activities;
+    }
+    catch ( pvt::ser_buffer_overrun& ) {
+        // Doesn't fit, report how much space is needed
+        ser.start_sizing();
+        ser& activities;
+        size = ser.size();
+        return false;
+    }
+    size = ser.size();
 
-    return buffer;
+    SST_EVENT_PROFILE_SIZE(activities.size(), size)
+
+    for ( unsigned int i = 0; i < activities.size(); i++ ) {
+        delete activities[i];
+    }
+    activities.clear();
+    return true;
 }
 
 } // namespace SST
@@ -50,12 +50,21 @@ public:
     void  clear();
     /** Accessor method to the internal queue */
     char* getData();
+    /**
+     * Serialize the queue directly into a caller supplied buffer
+     * (without a Header).  If the data fits, the events are deleted,
+     * the queue is cleared and true is returned.  Otherwise the queue
+     * is left untouched and false is returned.  Either way, size is
+     * set to the number of bytes the data needs.
+     */
+    bool  getData(char* dest, size_t max_size, size_t& size);
 
-    uint64_t getDataSize() { return buf_size + (activities.capacity() * sizeof(Activity*)); }
+    uint64_t getDataSize() { return buffer.size() + (activities.capacity() * sizeof(Activity*)); }
 
 private:
-    char*                  buffer;
-    size_t                 buf_size;
+    // Reused for every exchange.  It only grows, so once it reaches
+    // the working size, serializing does not allocate.
+    std::vector<char>      buffer;
     std::vector<Activity*> activities;
 
     Core::ThreadSafe::Spinlock slock;
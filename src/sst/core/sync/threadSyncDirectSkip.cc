@@ -36,6 +36,9 @@ ThreadSyncDirectSkip::ThreadSyncDirectSkip(int num_threads, int thread, Simulati
         barrier[0].resize(num_threads);
         barrier[1].resize(num_threads);
         barrier[2].resize(num_threads);
+        barrier[0].setName("thread_sync.arrive");
+        barrier[1].setName("thread_sync.flush");
+        barrier[2].setName("thread_sync.done");
     }
 
     if ( sim->getNumRanks().rank > 1 )
@@ -74,7 +77,7 @@ void
 ThreadSyncDirectSkip::execute()
 {
     after();
-    totalWaitTime += barrier[2].wait();
+    totalWaitTime += barrier[2].wait(thread);
 }
 
 uint64_t
@@ -85,6 +88,6 @@ ThreadSyncDirectSkip::getDataSize() const
 }
 
 
-Core::ThreadSafe::Barrier ThreadSyncDirectSkip::barrier[3];
+Core::ThreadSafe::TreeBarrier ThreadSyncDirectSkip::barrier[3];
 
 } // namespace SST
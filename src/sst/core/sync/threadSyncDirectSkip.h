@@ -60,14 +60,14 @@ public:
     uint64_t getDataSize() const;
 
 private:
-    SimTime_t                        my_max_period;
-    int                              num_threads;
-    int                              thread;
-    static SimTime_t                 localMinimumNextActivityTime;
-    Simulation_impl*                 sim;
-    static Core::ThreadSafe::Barrier barrier[3];
-    double                           totalWaitTime;
-    bool                             single_rank;
+    SimTime_t                            my_max_period;
+    int                                  num_threads;
+    int                                  thread;
+    static SimTime_t                     localMinimumNextActivityTime;
+    Simulation_impl*                     sim;
+    static Core::ThreadSafe::TreeBarrier barrier[3];
+    double                               totalWaitTime;
+    bool                                 single_rank;
 };
 
 
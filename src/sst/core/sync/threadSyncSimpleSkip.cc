@@ -39,6 +39,9 @@ ThreadSyncSimpleSkip::ThreadSyncSimpleSkip(int num_threads, int thread, Simulati
         barrier[0].resize(num_threads);
         barrier[1].resize(num_threads);
         barrier[2].resize(num_threads);
+        barrier[0].setName("thread_sync.arrive");
+        barrier[1].setName("thread_sync.flush");
+        barrier[2].setName("thread_sync.done");
     }
 
     if ( sim->getNumRanks().rank > 1 )
@@ -128,14 +131,21 @@ ThreadSyncSimpleSkip::after()
     nextSyncTime     = nextmin > nextminPlus ? nextmin : nextminPlus;
 }
 
+void
+ThreadSyncSimpleSkip::afterRankSync(SimTime_t next_activity_time)
+{
+    auto nextminPlus = next_activity_time + my_max_period;
+    nextSyncTime     = next_activity_time > nextminPlus ? next_activity_time : nextminPlus;
+}
+
 void
 ThreadSyncSimpleSkip::execute()
 {
-    totalWaitTime = barrier[0].wait();
+    totalWaitTime = barrier[0].wait(thread);
     before();
-    totalWaitTime = barrier[1].wait();
+    totalWaitTime = barrier[1].wait(thread);
     after();
-    totalWaitTime += barrier[2].wait();
+    totalWaitTime += barrier[2].wait(thread);
 }
 
 void
@@ -177,6 +187,6 @@ ThreadSyncSimpleSkip::getDataSize() const
     return count;
 }
 
-Core::ThreadSafe::Barrier ThreadSyncSimpleSkip::barrier[3];
+Core::ThreadSafe::TreeBarrier ThreadSyncSimpleSkip::barrier[3];
 
 } // namespace SST
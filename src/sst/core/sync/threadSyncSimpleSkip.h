@@ -41,6 +41,7 @@ public:
 
     void before() override;
     void after() override;
+    void afterRankSync(SimTime_t next_activity_time) override;
     void execute(void) override;
 
     /** Cause an exchange of Untimed Data to occur */
@@ -64,16 +65,16 @@ private:
     // the link is properly initialized with the remote data.
     std::unordered_map<std::string, Link*> link_map;
 
-    std::vector<ThreadSyncQueue*>    queues;
-    SimTime_t                        my_max_period;
-    int                              num_threads;
-    int                              thread;
-    static SimTime_t                 localMinimumNextActivityTime;
-    Simulation_impl*                 sim;
-    static Core::ThreadSafe::Barrier barrier[3];
-    double                           totalWaitTime;
-    bool                             single_rank;
-    Core::ThreadSafe::Spinlock       lock;
+    std::vector<ThreadSyncQueue*>        queues;
+    SimTime_t                            my_max_period;
+    int                                  num_threads;
+    int                                  thread;
+    static SimTime_t                     localMinimumNextActivityTime;
+    Simulation_impl*                     sim;
+    static Core::ThreadSafe::TreeBarrier barrier[3];
+    double                               totalWaitTime;
+    bool                                 single_rank;
+    Core::ThreadSafe::Spinlock           lock;
 };
 
 } // namespace SST
@@ -27,7 +27,8 @@ coreTestLinks::coreTestLinks(ComponentId_t id, Params& params) : Component(id),
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
 
-    my_id = params.find<int>("id", 0);
+    my_id      = params.find<int>("id", 0);
+    send_batch = params.find<bool>("send_batch", false);
 
     UnitAlgebra link_tb  = params.find<UnitAlgebra>("link_time_base", "1ns");
     UnitAlgebra send_lat = params.find<UnitAlgebra>("added_send_latency", found_sendlat);
@@ -41,6 +42,13 @@ coreTestLinks::coreTestLinks(ComponentId_t id, Params& params) : Component(id),
         "Wlink", link_tb.toString(),
         new Event::Handler<coreTestLinks, std::string>(this, &coreTestLinks::handleEvent, "West"));
 
+    if ( send_batch ) {
+        E->setBatchFunctor(
+            new Event::BatchHandler<coreTestLinks, std::string>(this, &coreTestLinks::handleBatch, "East"));
+        W->setBatchFunctor(
+            new Event::BatchHandler<coreTestLinks, std::string>(this, &coreTestLinks::handleBatch, "West"));
+    }
+
     if ( found_sendlat ) {
         E->addSendLatency(1, send_lat.toString());
         W->addSendLatency(1, send_lat.toString());
@@ -68,12 +76,27 @@ coreTestLinks::handleEvent(Event* ev, std::string from)
     if ( recv_count == 8 ) { primaryComponentOKToEndSim(); }
 }
 
+// incoming batches are handed to handleEvent one event at a time
+void
+coreTestLinks::handleBatch(std::vector<Event*>& events, std::string from)
+{
+    for ( auto* ev : events ) {
+        handleEvent(ev, from);
+    }
+}
+
 bool
 coreTestLinks::clockTic(Cycle_t cycle)
 {
     // Each clock cycle, send with increasing addtional latency, for 4 cycles, end of 5th
     if ( cycle == 5 ) { return true; }
 
+    if ( send_batch ) {
+        E->sendBatch(cycle, std::vector<Event*> { nullptr });
+        W->sendBatch(cycle, std::vector<Event*> { nullptr });
+        return false;
+    }
+
     E->send(cycle, nullptr);
     W->send(cycle, nullptr);
 
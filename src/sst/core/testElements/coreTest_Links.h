@@ -36,7 +36,8 @@ public:
         { "id",                 "ID of component", "" },
         { "added_send_latency", "Additional output latency to add to sends", "0ns"},
         { "added_recv_latency", "Additional input latency to add to incoming events", "0ns"},
-        { "link_time_base",     "Timebase for links", "1ns" }
+        { "link_time_base",     "Timebase for links", "1ns" },
+        { "send_batch",         "Send events with Link::sendBatch() and receive them with a batch handler", "false" }
     )
 
     // Optional since there is nothing to document
@@ -58,10 +59,12 @@ public:
     void finish() {}
 
 private:
-    int my_id;
-    int recv_count;
+    int  my_id;
+    int  recv_count;
+    bool send_batch;
 
     void         handleEvent(SST::Event* ev, std::string from);
+    void         handleBatch(std::vector<SST::Event*>& events, std::string from);
     virtual bool clockTic(SST::Cycle_t);
 
     SST::Link* E;
@@ -28,6 +28,7 @@ StatisticsComponentInt::StatisticsComponentInt(ComponentId_t id, Params& params)
     // these will set the random number generation.
     rng_count     = 0;
     rng_max_count = params.find<int64_t>("count", 1000);
+    batch_size    = params.find<size_t>("batch", 1);
 
     std::string rngType = params.find<std::string>("rng", "mersenne");
 
@@ -110,10 +111,19 @@ StatisticsComponentInt::Clock1Tick(Cycle_t UNUSED(CycleNum))
     int64_t  scaled_I64 = I64 / 1000000000000000;
 
     // Add the Statistic Data
-    stat1_U32->addData(scaled_U32);
-    stat2_U64->addData(scaled_U64);
-    stat3_I32->addData(scaled_I32);
-    stat4_I64->addData(scaled_I64);
+    if ( batch_size > 1 ) {
+        batch_U32.push_back(scaled_U32);
+        batch_U64.push_back(scaled_U64);
+        batch_I32.push_back(scaled_I32);
+        batch_I64.push_back(scaled_I64);
+        if ( batch_U32.size() >= batch_size || rng_count >= rng_max_count ) flushBatch();
+    }
+    else {
+        stat1_U32->addData(scaled_U32);
+        stat2_U64->addData(scaled_U64);
+        stat3_I32->addData(scaled_I32);
+        stat4_I64->addData(scaled_I64);
+    }
 
     // return false so we keep going or true to stop
     if ( rng_count >= rng_max_count ) {
@@ -125,6 +135,19 @@ StatisticsComponentInt::Clock1Tick(Cycle_t UNUSED(CycleNum))
     }
 }
 
+void
+StatisticsComponentInt::flushBatch()
+{
+    stat1_U32->addDataBatch(batch_U32);
+    stat2_U64->addDataBatch(batch_U64);
+    stat3_I32->addDataBatch(batch_I32);
+    stat4_I64->addDataBatch(batch_I64);
+    batch_U32.clear();
+    batch_U64.clear();
+    batch_I32.clear();
+    batch_I64.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////
 
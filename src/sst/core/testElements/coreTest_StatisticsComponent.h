@@ -40,7 +40,8 @@ public:
         { "seed_z", "The seed to use for the random number generator", "5" },
         { "seed", "The seed to use for the random number generator.", "11" },
         { "rng", "The random number generator to use (Marsaglia or Mersenne), default is Mersenne", "Mersenne"},
-        { "count", "The number of random numbers to generate, default is 1000", "1000" }
+        { "count", "The number of random numbers to generate, default is 1000", "1000" },
+        { "batch", "The number of values to buffer and add to each statistic with addDataBatch, default is 1", "1" }
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -70,11 +71,13 @@ private:
     void operator=(const StatisticsComponentInt&);         // do not implement
 
     virtual bool Clock1Tick(SST::Cycle_t);
+    void         flushBatch();
 
     Random*     rng;
     std::string rng_type;
     int         rng_max_count;
     int         rng_count;
+    size_t      batch_size;
     Output&     output;
 
     // Statistics
@@ -82,6 +85,12 @@ private:
     Statistic<uint64_t>* stat2_U64;
     Statistic<int32_t>*  stat3_I32;
     Statistic<int64_t>*  stat4_I64;
+
+    // Values waiting to be added when batching
+    std::vector<uint32_t> batch_U32;
+    std::vector<uint64_t> batch_U64;
+    std::vector<int32_t>  batch_I32;
+    std::vector<int64_t>  batch_I64;
 };
 
 class StatisticsComponentFloat : public SST::Component
@@ -0,0 +1,83 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/threadsafe.h"
+
+#include <climits>
+#include <locale>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace SST {
+namespace Core {
+namespace ThreadSafe {
+
+WaitPolicy::Mode WaitPolicy::mode = WaitPolicy::Mode::SPIN_YIELD;
+
+thread_local BarrierWaitListener* BarrierWaitListener::listener = nullptr;
+
+bool
+WaitPolicy::setMode(const std::string& mode_str)
+{
+    std::string lower(mode_str);
+    std::locale loc;
+    for ( auto& ch : lower )
+        ch = std::tolower(ch, loc);
+
+    if ( lower == "spin" )
+        mode = Mode::SPIN;
+    else if ( lower == "spin-yield" )
+        mode = Mode::SPIN_YIELD;
+    else if ( lower == "futex" ) {
+#ifdef __linux__
+        mode = Mode::FUTEX;
+#else
+        mode = Mode::SPIN_YIELD;
+#endif
+    }
+    else
+        return false;
+    return true;
+}
+
+void
+WaitPolicy::futexWait(std::atomic<uint32_t>& word, uint32_t value)
+{
+#ifdef __linux__
+    // Returns right away if word no longer holds value, so a wake that
+    // happens between the caller's check and this call is not lost
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+#else
+    (void)word;
+    (void)value;
+    std::this_thread::yield();
+#endif
+}
+
+void
+WaitPolicy::futexWake(std::atomic<uint32_t>& word)
+{
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+} // namespace ThreadSafe
+} // namespace Core
+} // namespace SST
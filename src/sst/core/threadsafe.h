@@ -22,8 +22,11 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 //#include <stdalign.h>
@@ -44,17 +47,139 @@ namespace ThreadSafe {
 #define CACHE_ALIGNED_T           alignas(64)
 #endif
 
+/**
+ * How threads wait in Barrier and TreeBarrier.  Set once per run from
+ * the --barrier-wait-policy option, before the simulation threads
+ * start.
+ */
+class WaitPolicy
+{
+public:
+    enum class Mode {
+        SPIN,       /*!< Busy wait.  Lowest wakeup latency when every thread has its own core */
+        SPIN_YIELD, /*!< Spin, then yield the core, then sleep (default) */
+        FUTEX       /*!< Spin briefly, then block in the kernel until woken.  Best when oversubscribed */
+    };
+
+    /**
+     * Set the mode from the value of the --barrier-wait-policy option
+     * (SPIN, SPIN-YIELD or FUTEX).  FUTEX falls back to SPIN-YIELD on
+     * systems without futexes.
+     * @return false if the mode is not valid
+     */
+    static bool setMode(const std::string& mode);
+    static Mode getMode() { return mode; }
+
+    /**
+     * Wait until done(value) returns true, where value is the current
+     * value of word.  In FUTEX mode the thread blocks on word, so
+     * whoever changes it has to call wake().
+     */
+    template <typename Cond>
+    static void waitUntil(std::atomic<uint32_t>& word, Cond done)
+    {
+        uint32_t count = 0;
+        while ( true ) {
+            uint32_t value = word.load(std::memory_order_acquire);
+            if ( done(value) ) return;
+            count++;
+            switch ( mode ) {
+            case Mode::SPIN:
+                sst_pause();
+                break;
+            case Mode::SPIN_YIELD:
+                if ( count < 1024 ) { sst_pause(); }
+                else if ( count < (1024 * 1024) ) {
+                    std::this_thread::yield();
+                }
+                else {
+                    struct timespec ts;
+                    ts.tv_sec  = 0;
+                    ts.tv_nsec = 1000;
+                    nanosleep(&ts, nullptr);
+                }
+                break;
+            case Mode::FUTEX:
+                if ( count < 128 ) { sst_pause(); }
+                else {
+                    futexWait(word, value);
+                }
+                break;
+            }
+        }
+    }
+
+    /** Wake all threads blocked on word.  Does nothing unless in FUTEX mode */
+    static void wake(std::atomic<uint32_t>& word)
+    {
+        if ( mode == Mode::FUTEX ) futexWake(word);
+    }
+
+private:
+    static void futexWait(std::atomic<uint32_t>& word, uint32_t value);
+    static void futexWake(std::atomic<uint32_t>& word);
+
+    static Mode mode;
+};
+
+/**
+ * Gets the time the calling thread spends waiting at each named
+ * barrier.  Each thread can have its own listener, for example a sync
+ * profile tool.  Barriers without a name are not reported.
+ */
+class BarrierWaitListener
+{
+public:
+    virtual ~BarrierWaitListener() {}
+
+    /** Called with the time spent waiting at barrier, in nanoseconds */
+    virtual void barrierWait(const char* barrier, uint64_t wait_time) = 0;
+
+    /** Set the listener for the calling thread (nullptr to remove it) */
+    static void                 setListener(BarrierWaitListener* l) { listener = l; }
+    static BarrierWaitListener* getListener() { return listener; }
+
+private:
+    static thread_local BarrierWaitListener* listener;
+};
+
+/** Reports the time from construction to destruction to the calling thread's BarrierWaitListener */
+class BarrierWaitTimer
+{
+    BarrierWaitListener*                  listener;
+    const char*                           barrier;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    BarrierWaitTimer(const char* barrier) :
+        listener(barrier ? BarrierWaitListener::getListener() : nullptr),
+        barrier(barrier)
+    {
+        if ( listener ) start = std::chrono::steady_clock::now();
+    }
+
+    ~BarrierWaitTimer()
+    {
+        if ( listener )
+            listener->barrierWait(
+                barrier,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+};
+
 class CACHE_ALIGNED_T Barrier
 {
-    size_t              origCount;
-    std::atomic<bool>   enabled;
-    std::atomic<size_t> count, generation;
+    size_t                origCount;
+    std::atomic<bool>     enabled;
+    std::atomic<size_t>   count;
+    std::atomic<uint32_t> generation;
+    const char*           name;
 
 public:
-    Barrier(size_t count) : origCount(count), enabled(true), count(count), generation(0) {}
+    Barrier(size_t count) : origCount(count), enabled(true), count(count), generation(0), name(nullptr) {}
 
     // Come g++ 4.7, this can become a delegating constructor
-    Barrier() : origCount(0), enabled(false), count(0), generation(0) {}
+    Barrier() : origCount(0), enabled(false), count(0), generation(0), name(nullptr) {}
 
     /** ONLY call this while nobody is in wait() */
     void resize(size_t newCount)
@@ -64,6 +189,9 @@ public:
         enabled.store(true);
     }
 
+    /** Name used to report wait times to the BarrierWaitListener */
+    void setName(const char* barrier_name) { name = barrier_name; }
+
     /**
      * Wait for all threads to reach this point.
      * @return 0.0, or elapsed time spent waiting, if configured with --enable-profile
@@ -72,9 +200,10 @@ public:
     {
         double elapsed = 0.0;
         if ( enabled ) {
-            auto startTime = SST::Core::Profile::now();
+            auto             startTime = SST::Core::Profile::now();
+            BarrierWaitTimer timer(name);
 
-            size_t gen = generation.load(std::memory_order_acquire);
+            uint32_t gen = generation.load(std::memory_order_acquire);
             asm("" ::: "memory");
             size_t c = count.fetch_sub(1) - 1;
             if ( 0 == c ) {
@@ -84,23 +213,10 @@ public:
                 /* Incrementing generation causes release */
                 generation.fetch_add(1, std::memory_order_release);
                 __sync_synchronize();
+                WaitPolicy::wake(generation);
             }
             else {
-                /* Try spinning first */
-                uint32_t count = 0;
-                do {
-                    count++;
-                    if ( count < 1024 ) { sst_pause(); }
-                    else if ( count < (1024 * 1024) ) {
-                        std::this_thread::yield();
-                    }
-                    else {
-                        struct timespec ts;
-                        ts.tv_sec  = 0;
-                        ts.tv_nsec = 1000;
-                        nanosleep(&ts, nullptr);
-                    }
-                } while ( gen == generation.load(std::memory_order_acquire) );
+                WaitPolicy::waitUntil(generation, [gen](uint32_t value) { return gen != value; });
             }
             elapsed = SST::Core::Profile::getElapsed(startTime);
         }
@@ -112,6 +228,139 @@ public:
         enabled.store(false);
         count.store(0);
         ++generation;
+        WaitPolicy::wake(generation);
+    }
+};
+
+/**
+ * Barrier that scales to large thread counts.  The centralized Barrier
+ * has every thread update one counter, which turns into a long queue
+ * of cache line transfers at 64+ threads.  Here each thread owns a node
+ * in a static tree with a fan-in of four.  A thread arrives at its own
+ * node, and whichever thread completes a node carries the arrival up
+ * to the parent node, so each counter is only updated by a few threads.
+ * The thread that completes the root releases everyone by bumping a
+ * single generation flag.
+ *
+ * Arrival and release can also be split.  arrive() returns true on
+ * thread 0 once every thread has arrived, and returns false right away
+ * on the other threads, which then wait in waitForRelease().  Thread 0
+ * can do work that needs all of the other threads held (e.g. MPI
+ * calls) before calling release().
+ *
+ * The counters are 32 bits so they can be futex words; they wrap, so
+ * they are only compared for equality.
+ */
+class TreeBarrier
+{
+    static constexpr uint32_t fan_in = 4;
+
+    struct CACHE_ALIGNED_T Node
+    {
+        std::atomic<uint32_t> arrived; /* Arrivals at this node, never reset */
+        uint32_t              episode; /* Only touched by the owning thread */
+        uint32_t              size;    /* Owning thread plus its children */
+    };
+
+    size_t                  num_threads;
+    std::unique_ptr<Node[]> nodes;
+    const char*             name;
+    CACHE_ALIGNED(std::atomic<uint32_t>, all_arrived);
+    CACHE_ALIGNED(std::atomic<uint32_t>, generation);
+
+    /** Arrive up the tree.  Returns true on the last thread to arrive */
+    bool combine(size_t thread, uint32_t episode)
+    {
+        size_t node = thread;
+        while ( true ) {
+            uint32_t target = episode * nodes[node].size;
+            if ( nodes[node].arrived.fetch_add(1, std::memory_order_acq_rel) + 1 != target ) return false;
+            if ( 0 == node ) return true;
+            node = (node - 1) / fan_in;
+        }
+    }
+
+    /** Set flag to value and wake anyone waiting on it */
+    static void signal(std::atomic<uint32_t>& flag, uint32_t value)
+    {
+        flag.store(value, std::memory_order_release);
+        WaitPolicy::wake(flag);
+    }
+
+    static void waitFor(std::atomic<uint32_t>& flag, uint32_t value)
+    {
+        WaitPolicy::waitUntil(flag, [value](uint32_t current) { return current == value; });
+    }
+
+public:
+    TreeBarrier(size_t count) : num_threads(0), name(nullptr), all_arrived(0), generation(0) { resize(count); }
+    TreeBarrier() : num_threads(0), name(nullptr), all_arrived(0), generation(0) {}
+
+    /** ONLY call this while nobody is in wait() */
+    void resize(size_t newCount)
+    {
+        num_threads = newCount;
+        nodes.reset(new Node[newCount]);
+        for ( size_t i = 0; i < newCount; i++ ) {
+            nodes[i].arrived.store(0);
+            nodes[i].episode = 0;
+            nodes[i].size    = 1;
+        }
+        for ( size_t i = 1; i < newCount; i++ )
+            nodes[(i - 1) / fan_in].size++;
+        all_arrived.store(0);
+        generation.store(0);
+    }
+
+    /** Name used to report wait times to the BarrierWaitListener */
+    void setName(const char* barrier_name) { name = barrier_name; }
+
+    /**
+     * Arrive at the barrier.  On thread 0 this waits for all of the
+     * threads to arrive.
+     * @return true on thread 0, which must call release(), false on
+     * all other threads, which must call waitForRelease()
+     */
+    bool arrive(size_t thread)
+    {
+        uint32_t episode = ++nodes[thread].episode;
+        bool     last    = combine(thread, episode);
+        if ( 0 == thread ) {
+            if ( !last ) {
+                BarrierWaitTimer timer(name);
+                waitFor(all_arrived, episode);
+            }
+            return true;
+        }
+        if ( last ) signal(all_arrived, episode);
+        return false;
+    }
+
+    /** Release the threads waiting in waitForRelease().  Thread 0 only */
+    void release() { signal(generation, nodes[0].episode); }
+
+    /** Wait for thread 0 to call release() */
+    void waitForRelease(size_t thread)
+    {
+        BarrierWaitTimer timer(name);
+        waitFor(generation, nodes[thread].episode);
+    }
+
+    /**
+     * Wait for all threads to reach this point.
+     * @return 0.0, or elapsed time spent waiting, if configured with --enable-profile
+     */
+    double wait(size_t thread)
+    {
+        if ( num_threads <= 1 ) return 0.0;
+        auto             startTime = SST::Core::Profile::now();
+        BarrierWaitTimer timer(name);
+        uint32_t         episode = ++nodes[thread].episode;
+        if ( combine(thread, episode) )
+            signal(generation, episode);
+        else
+            waitFor(generation, episode);
+        return SST::Core::Profile::getElapsed(startTime);
     }
 };
 
@@ -314,6 +563,103 @@ public:
     }
 };
 
+/**
+ * Lock-free unbounded queue for exactly one producer thread and one
+ * consumer thread.  Nodes already consumed are recycled by the
+ * producer, so once the queue has grown to its working size inserts
+ * no longer allocate.
+ */
+template <typename T>
+class UnboundedSPSCQueue
+{
+    struct Node
+    {
+        std::atomic<Node*> next;
+        T                  data;
+
+        Node() : next(nullptr) {}
+    };
+
+    // Consumer side: last node consumed ('tail' is always a dummy)
+    CACHE_ALIGNED(std::atomic<Node*>, tail);
+
+    // Producer side: last node inserted, oldest recyclable node and
+    // the producer's cached copy of tail
+    CACHE_ALIGNED(Node*, head);
+    Node* first;
+    Node* tail_copy;
+
+    Node* allocNode()
+    {
+        if ( first != tail_copy ) {
+            Node* n = first;
+            first   = first->next.load(std::memory_order_relaxed);
+            return n;
+        }
+        tail_copy = tail.load(std::memory_order_acquire);
+        if ( first != tail_copy ) {
+            Node* n = first;
+            first   = first->next.load(std::memory_order_relaxed);
+            return n;
+        }
+        return new Node();
+    }
+
+public:
+    UnboundedSPSCQueue()
+    {
+        Node* n = new Node();
+        tail.store(n);
+        head = first = tail_copy = n;
+    }
+
+    ~UnboundedSPSCQueue()
+    {
+        while ( first != nullptr ) { // release the list
+            Node* tmp = first;
+            first     = tmp->next.load(std::memory_order_relaxed);
+            delete tmp;
+        }
+    }
+
+    /** Only call from the producer thread */
+    void insert(const T& t)
+    {
+        Node* n = allocNode();
+        n->next.store(nullptr, std::memory_order_relaxed);
+        n->data = t;
+        head->next.store(n, std::memory_order_release); // publish to consumer
+        head = n;
+    }
+
+    /** Only call from the consumer thread */
+    bool try_remove(T& result)
+    {
+        Node* t = tail.load(std::memory_order_relaxed);
+        Node* n = t->next.load(std::memory_order_acquire);
+        if ( n == nullptr ) return false;
+        result = n->data;
+        tail.store(n, std::memory_order_release); // hand 't' back to producer
+        return true;
+    }
+
+    bool empty() const { return tail.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr; }
+
+    /**
+     * Call func on every item in the queue without removing them.
+     * Only safe when the consumer is not removing items concurrently.
+     */
+    template <typename F>
+    void for_each(F func) const
+    {
+        Node* n = tail.load(std::memory_order_acquire)->next.load(std::memory_order_acquire);
+        while ( n != nullptr ) {
+            func(n->data);
+            n = n->next.load(std::memory_order_acquire);
+        }
+    }
+};
+
 } // namespace ThreadSafe
 } // namespace Core
 } // namespace SST
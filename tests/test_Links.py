@@ -13,20 +13,24 @@ import sys
 
 dangling = False
 wrong_port = False
+send_batch = False
 if len(sys.argv) == 2:
     if sys.argv[1] == "dangling": dangling=True
     if sys.argv[1] == "wrong_port": wrong_port=True
+    if sys.argv[1] == "batch": send_batch=True
 
 # Define the simulation components
 comp_c0 = sst.Component("c1", "coreTestElement.coreTestLinks")
 comp_c0.addParams({
     "id" : 0,
+    "send_batch" : send_batch,
     "link_time_base"     : "1 ns"
 })
 
 comp_c1 = sst.Component("c0_1", "coreTestElement.coreTestLinks")
 comp_c1.addParams({
     "id" : 1,
+    "send_batch" : send_batch,
     "added_send_latency" : "10 ns",
     "link_time_base"     : "2 ns"
 })
@@ -34,6 +38,7 @@ comp_c1.addParams({
 comp_c2 = sst.Component("c1_0", "coreTestElement.coreTestLinks")
 comp_c2.addParams({
     "id" : 2,
+    "send_batch" : send_batch,
     "added_recv_latency" : "15 ns",
     "link_time_base"     : "3 ns"
 })
@@ -41,6 +46,7 @@ comp_c2.addParams({
 comp_c3 = sst.Component("c1_1", "coreTestElement.coreTestLinks")
 comp_c3.addParams({
     "id" : 3,
+    "send_batch" : send_batch,
     "added_send_latency" : "20 ns",
     "added_recv_latency" : "25 ns",
     "link_time_base"     : "4 ns"
@@ -0,0 +1,100 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# This script tests the columnar statistic output.  The output type
+# can be overridden from the command line (e.g. "csv") to compare the
+# columnar output against another output.
+
+output_type = "columnar"
+if len(sys.argv) > 1:
+    output_type = sys.argv[1]
+
+output_file = "test_StatisticsComponent_columnar.sstcol"
+if output_type == "csv":
+    output_file = "test_StatisticsComponent_columnar.csv"
+
+sst.setProgramOptions({
+    "partitioner" : "roundrobin"
+})
+
+sst.setStatisticLoadLevel(7)
+
+if output_type == "columnar":
+    sst.setStatisticOutput("sst.statOutputColumnar", {
+        "filepath" : output_file,
+        # Small buffer so the columns are written in several chunks
+        "buffersize" : "512"
+    })
+else:
+    sst.setStatisticOutput("sst.statOutputCSV", {
+        "filepath" : output_file,
+        "outputrank" : "0"
+    })
+
+# Integer statistics, output periodically
+StatInt0 = sst.Component("StatInt0", "coreTestElement.StatisticsComponent.int")
+StatInt0.addParams({
+      "rng" : "marsaglia",
+      "count" : "100",
+      "seed_w" : "1447",
+      "seed_z" : "1053"
+})
+StatInt0.enableAllStatistics({
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "7 ns",
+    "resetOnOutput" : True
+})
+
+# Float statistics, output periodically
+StatFloat0 = sst.Component("StatFloat0", "coreTestElement.StatisticsComponent.float")
+StatFloat0.addParams({
+      "rng" : "mersenne",
+      "count" : "100",
+      "seed" : "1451"
+})
+StatFloat0.enableAllStatistics({
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "23 ns"
+})
+
+# Histogram with more fields, output at the end of simulation
+StatHist0 = sst.Component("StatHist0", "coreTestElement.StatisticsComponent.int")
+StatHist0.addParams({
+      "rng" : "marsaglia",
+      "count" : "100",
+      "seed_w" : "1449",
+      "seed_z" : "1055"
+})
+StatHist0.enableStatistics(["stat1_U32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "0",
+    "binwidth" : "500",
+    "numbins" : "10",
+    "IncludeOutOfBounds" : "1"
+})
+
+# Statistic group sharing the output
+StatGroup0 = sst.StatisticGroup("StatGroup0")
+StatGroupObj0 = sst.Component("StatGroupObj0", "coreTestElement.StatisticsComponent.int")
+StatGroupObj0.addParams({
+      "rng" : "marsaglia",
+      "count" : "100",
+      "seed_w" : "1457",
+      "seed_z" : "1063"
+})
+StatGroup0.addComponent(StatGroupObj0)
+StatGroup0.addStatistic("stat4_I64", {
+    "type" : "sst.AccumulatorStatistic",
+    "resetOnOutput" : True})
+StatGroup0.setFrequency("19ns")
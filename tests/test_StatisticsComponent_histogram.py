@@ -0,0 +1,82 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# This script tests the linear and log-scale histogram statistics.  The
+# two components generate the same values, but the second one adds
+# them with addDataBatch, so their histograms should match.
+
+sst.setProgramOptions({
+    "partitioner" : "roundrobin"
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+for name, batch in [("HistSingle", "1"), ("HistBatch", "7")]:
+    comp = sst.Component(name, "coreTestElement.StatisticsComponent.int")
+    comp.addParams({
+        "rng" : "marsaglia",
+        "count" : "200",
+        "seed_w" : "1451",
+        "seed_z" : "1061",
+        "batch" : batch
+    })
+
+    # Bins start at minvalue, with values on both sides out of bounds
+    comp.enableStatistics(["stat1_U32"], {
+        "type" : "sst.HistogramStatistic",
+        "minvalue" : "100",
+        "binwidth" : "50",
+        "numbins" : "5"
+    })
+    comp.enableStatistics(["stat4_I64"], {
+        "type" : "sst.HistogramStatistic",
+        "minvalue" : "-5000",
+        "binwidth" : "1000",
+        "numbins" : "10"
+    })
+
+    # Log-scale bins from 0, and from a negative minvalue with values on
+    # both sides out of bounds
+    comp.enableStatistics(["stat2_U64"], {
+        "type" : "sst.LogHistogramStatistic",
+        "maxvalue" : "20000",
+        "subbins" : "4"
+    })
+    comp.enableStatistics(["stat3_I32"], {
+        "type" : "sst.LogHistogramStatistic",
+        "minvalue" : "-100",
+        "maxvalue" : "150",
+        "subbins" : "3"
+    })
+
+# Log-scale bins that reach the top of the type, where the last bin's
+# upper bound has to be clamped rather than computed from the next bin
+comp = sst.Component("HistWide", "coreTestElement.StatisticsComponent.int")
+comp.addParams({
+    "rng" : "marsaglia",
+    "count" : "200",
+    "seed_w" : "1451",
+    "seed_z" : "1061"
+})
+comp.enableStatistics(["stat2_U64"], {
+    "type" : "sst.LogHistogramStatistic",
+    "maxvalue" : "18446744073709551615",
+    "subbins" : "1"
+})
+comp.enableStatistics(["stat3_I32"], {
+    "type" : "sst.LogHistogramStatistic",
+    "minvalue" : "-100",
+    "maxvalue" : "2147483647",
+    "subbins" : "1"
+})
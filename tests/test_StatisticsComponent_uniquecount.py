@@ -0,0 +1,50 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# This script tests the exact and approximate unique count statistics.
+# Each Exact/Approx pair generates the same values.  The approximate
+# stat2_U64 and stat4_I64 statistics are merged across all the Approx
+# components, so GlobalUniqueItems does not depend on how the
+# components are spread over ranks and threads.
+
+sst.setProgramOptions({
+    "partitioner" : "roundrobin"
+})
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+seeds = [("1459", "1069"), ("1471", "1087"), ("1483", "1093")]
+
+for i, (seed_w, seed_z) in enumerate(seeds):
+    params = {
+        "rng" : "marsaglia",
+        "count" : "3000",
+        "seed_w" : seed_w,
+        "seed_z" : seed_z
+    }
+
+    exact = sst.Component("Exact{0}".format(i), "coreTestElement.StatisticsComponent.int")
+    exact.addParams(params)
+    exact.enableAllStatistics({ "type" : "sst.UniqueCountStatistic" })
+
+    approx = sst.Component("Approx{0}".format(i), "coreTestElement.StatisticsComponent.int")
+    approx.addParams(params)
+    approx.enableStatistics(["stat1_U32", "stat3_I32"], {
+        "type" : "sst.ApproxUniqueCountStatistic",
+        "precision" : "6"
+    })
+    approx.enableStatistics(["stat2_U64", "stat4_I64"], {
+        "type" : "sst.ApproxUniqueCountStatistic",
+        "global" : "true"
+    })
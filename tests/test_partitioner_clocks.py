@@ -0,0 +1,22 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# Clocked components with no links, so their partition costs can only
+# come from the time spent in their clock handlers.
+
+for i in range(8):
+    comp = sst.Component("clocker%d"%i, "coreTestElement.coreTestClockerComponent")
+    comp.addParams({
+        "clockcount" : str(5000 * (i + 1)),
+        "clock" : "1GHz"
+    })
@@ -0,0 +1,50 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# Two clusters of components linked directly through their own ports,
+# with some no-cut links inside each cluster.  Inside a cluster, the
+# components form two rings with short links.  The clusters are joined
+# by two long links, so the best split into two parts is one cluster
+# per part.  The components of the two clusters are created
+# alternately, so that once the no-cut groups are collapsed the
+# partition graph ids no longer match the component ids.
+
+sst.setProgramOption("stop-at", "10us")
+
+size = 6
+clusters = {}
+for i in range(size):
+    for c in [ "A", "B" ]:
+        comp = sst.Component("%s%d"%(c, i), "coreTestElement.coreTestComponent")
+        comp.addParams({
+            "workPerCycle" : "10",
+            "commSize" : "10",
+            "commFreq" : "100"
+        })
+        clusters.setdefault(c, []).append(comp)
+
+for c, comps in clusters.items():
+    for i in range(size):
+        link = sst.Link("%s_ew_%d"%(c, i))
+        link.connect( (comps[i], "Elink", "1ns"), (comps[(i + 1) % size], "Wlink", "1ns") )
+        if i % 3 == 0: link.setNoCut()
+
+        # The last north/south link of each cluster goes to the other
+        # cluster instead
+        if i == size - 1: continue
+        link = sst.Link("%s_ns_%d"%(c, i))
+        link.connect( (comps[i], "Nlink", "1ns"), (comps[i + 1], "Slink", "1ns") )
+
+for c, other in [ ("A", "B"), ("B", "A") ]:
+    link = sst.Link("%s_%s_bridge"%(c, other))
+    link.connect( (clusters[c][size - 1], "Nlink", "1000ns"), (clusters[other][0], "Slink", "1000ns") )
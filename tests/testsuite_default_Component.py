@@ -56,18 +56,22 @@ class testcase_Component(SSTTestCase):
     def test_Component_time_overflow(self):
         self.component_test_template("Component_time_overflow", 1)
 
+    def test_Component_clock_batching(self):
+        self.component_test_template("Component", other_args="--clock-batching", outname="Component_clock_batching")
+
 #####
 
-    def component_test_template(self, testtype, exp_rc = 0):
+    def component_test_template(self, testtype, exp_rc = 0, other_args="", outname=None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
         sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
         reffile = "{0}/refFiles/test_{1}.out".format(testsuitedir, testtype)
-        outfile = "{0}/test_{1}.out".format(outdir, testtype)
-        errfile = "{0}/test_{1}.err".format(outdir, testtype)
+        if outname is None: outname = testtype
+        outfile = "{0}/test_{1}.out".format(outdir, outname)
+        errfile = "{0}/test_{1}.err".format(outdir, outname)
 
-        self.run_sst(sdlfile, outfile, errfile, expected_rc = exp_rc)
+        self.run_sst(sdlfile, outfile, errfile, other_args=other_args, expected_rc = exp_rc)
 
         # Check the results if exp_rc isn't equal to 0, then we are
         # expecting an error and we'll put in a LineFilter to filter
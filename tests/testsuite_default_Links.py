@@ -53,6 +53,9 @@ class testcase_Links(SSTTestCase):
     def test_Links(self):
         self.component_test_template("basic")
 
+    def test_Links_batch(self):
+        self.component_test_template("batch", "--model-options=batch")
+
     def test_Links_dangling(self):
         self.component_test_template("dangling", "--model-options=dangling", 1)
 
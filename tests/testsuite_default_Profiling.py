@@ -0,0 +1,118 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import glob
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+def read_profile_counts(path, tool):
+    """Sum the "name, count" rows written by a profile tool on every rank
+    and thread into a dict keyed by name.  With more than one rank, each
+    rank writes its own file with the rank added before the extension."""
+    root, ext = os.path.splitext(path)
+    paths = [path] if os.path.isfile(path) else sorted(glob.glob("{0}[0-9]*{1}".format(root, ext)))
+
+    counts = {}
+    for rank_path in paths:
+        in_tool = False
+        with open(rank_path) as f:
+            for line in f:
+                line = line.strip()
+                if line == tool:
+                    in_tool = True
+                elif line == "" or line.startswith("Rank ="):
+                    in_tool = False
+                elif in_tool and not line.startswith("Name,"):
+                    name, value = line.rsplit(",", 1)
+                    counts[name] = counts.get(name, 0) + int(value)
+    return counts
+
+################################################################################
+
+class testcase_Profiling(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_clock_count(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        outfile = "{0}/test_Profiling_clock_count.out".format(outdir)
+        proffile = "{0}/test_Profiling_clock_count.prof".format(outdir)
+
+        options = "--enable-profiling=\"clocks:sst.profile.handler.clock.count(level=component)[clock]\" --profiling-output={0}".format(proffile)
+        self.run_sst(sdlfile, outfile, other_args=options)
+
+        # Every component has a clock, so every one of them should show up with ticks counted
+        counts = read_profile_counts(proffile, "clocks")
+        self.assertTrue(len(counts) > 0, "No clock handlers were profiled in {0}".format(proffile))
+        for name, count in counts.items():
+            self.assertTrue(count > 0, "Clock handler of {0} was never profiled in {1}".format(name, proffile))
+
+    def test_event_count_batch(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Links.py".format(testsuitedir)
+
+        # Events sent with sendBatch() should be seen by the event profile
+        # tools the same as events sent one at a time
+        counts = {}
+        for testtype in [ "single", "batch" ]:
+            outfile = "{0}/test_Profiling_event_count_{1}.out".format(outdir, testtype)
+            proffile = "{0}/test_Profiling_event_count_{1}.prof".format(outdir, testtype)
+
+            options = "--model-options={0} --enable-profiling=\"events:sst.profile.handler.event.count(level=component)[event]\" --profiling-output={1}".format(testtype, proffile)
+            self.run_sst(sdlfile, outfile, other_args=options)
+            counts[testtype] = read_profile_counts(proffile, "events")
+
+        self.assertTrue(len(counts["single"]) > 0, "No event handlers were profiled")
+        for name, count in counts["single"].items():
+            self.assertTrue(count > 0, "Event handler of {0} was never profiled".format(name))
+        self.assertEqual(counts["single"], counts["batch"], "Batched events were not all profiled")
@@ -0,0 +1,107 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_RankSync(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_adaptive(self):
+        self.ranksync_test_template("adaptive", "6 6", "--adaptive-rank-sync")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_nonblocking(self):
+        self.ranksync_test_template("nonblocking", "6 6", "--nonblocking-rank-sync")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_nonblocking_adaptive(self):
+        self.ranksync_test_template("nonblocking_adaptive", "6 6", "--nonblocking-rank-sync --adaptive-rank-sync")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_nonblocking_threads(self):
+        self.ranksync_test_template("nonblocking_threads", "6 6", "--nonblocking-rank-sync", num_threads=2)
+
+    def test_futex_barrier_threads(self):
+        self.ranksync_test_template(
+            "futex_barrier_threads", "6 6", "--barrier-wait-policy=futex", num_ranks=1, num_threads=2)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_shmem(self):
+        self.ranksync_test_template("shmem", "6 6", "--shmem-rank-sync")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_shmem_4ranks(self):
+        self.ranksync_test_template("shmem_4ranks", "6 6", "--shmem-rank-sync", num_ranks=4)
+
+#####
+
+    def ranksync_test_template(self, testtype, model_options, extra_args="", num_ranks=2, num_threads=1):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        ref_options = "--model-options=\"{0}\"".format(model_options)
+        options = "{0} {1}".format(ref_options, extra_args)
+
+        # Set the various file paths
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_ref = "{0}/test_ranksync_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_ranksync_check_{1}.out".format(outdir, testtype)
+
+        # Do a reference run on a single rank, then a run across ranks
+        # using the rank sync under test
+        self.run_sst(sdlfile, outfile_ref, other_args=ref_options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=options, num_ranks=num_ranks, num_threads=num_threads)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
@@ -13,6 +13,7 @@
 
 import os
 import filecmp
+import struct
 
 from sst_unittest import *
 from sst_unittest_support import *
@@ -35,6 +36,62 @@ def initializeTestModule_SingleInstance(class_inst):
 
 ################################################################################
 
+def read_columnar_stat_file(path):
+    """Decode a file written by sst.statOutputColumnar into one line of
+       text per row: the statistic names followed by field=value pairs"""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[0:8] != b"SSTCOLMN" or data[-8:] != b"SSTCOLMN":
+        raise ValueError("{0} is not a columnar statistic file".format(path))
+    version, byte_order_mark, rank, num_ranks = struct.unpack_from("=IIII", data, 8)
+    if version != 1 or byte_order_mark != 0x01020304:
+        raise ValueError("{0} has an unsupported version or byte order".format(path))
+
+    pos = struct.unpack_from("=Q", data, len(data) - 16)[0]
+
+    def get(fmt):
+        nonlocal pos
+        value = struct.unpack_from("=" + fmt, data, pos)[0]
+        pos += struct.calcsize("=" + fmt)
+        return value
+
+    def get_string():
+        nonlocal pos
+        size = get("I")
+        value = data[pos:pos + size].decode()
+        pos += size
+        return value
+
+    formats = {"i32" : "i", "u32" : "I", "i64" : "q", "u64" : "Q", "f32" : "f", "f64" : "d"}
+    rows = []
+    for table in range(get("Q")):
+        names = [get_string() for i in range(4)]
+        num_rows = get("Q")
+        columns = []
+        for column in range(get("I")):
+            name = get_string()
+            ftype = get_string()
+            width = get("I")
+            values = []
+            for chunk in range(get("Q")):
+                offset = get("Q")
+                count = get("Q")
+                values += struct.unpack_from("={0}{1}".format(count, formats[ftype]), data, offset)
+            columns.append(("{0}.{1}".format(name, ftype), ftype, values))
+
+        for row in range(num_rows):
+            fields = []
+            for name, ftype, values in columns:
+                value = values[row]
+                if ftype[0] == "f":
+                    value = "{0:f}".format(value)
+                fields.append("{0}={1}".format(name, value))
+            rows.append(", ".join(names + fields))
+    return rows
+
+################################################################################
+
 class testcase_StatisticComponent(SSTTestCase):
 
     def initializeClass(self, testName):
@@ -54,16 +111,85 @@ class testcase_StatisticComponent(SSTTestCase):
 #####
 
     num_threads = test_engine_globals.TESTENGINE_SSTRUN_NUMTHREADS
+    num_ranks = test_engine_globals.TESTENGINE_SSTRUN_NUMRANKS
 
     #@unittest.skipIf(num_threads > 1, "Statistic test currently fails with threads due to strange interactions of independent threads with stats")
     def test_StatisticsBasic(self):
         self.Statistics_test_template("basic")
 
+    def test_StatisticsBasicAsync(self):
+        self.Statistics_test_template("basic", async_output=True)
+
+    def test_StatisticsColumnar(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_columnar.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_StatisticsComponent_columnar.out".format(testsuitedir)
+        outfile = "{0}/test_StatisticsComponent_columnar.out".format(outdir)
+        colfile = "{0}/test_StatisticsComponent_columnar.sstcol".format(outdir)
+        decodedfile = "{0}/test_StatisticsComponent_columnar_decoded.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, set_cwd=outdir)
+
+        # Each rank writes its own file when there is more than one rank
+        rows = []
+        colfiles = [colfile]
+        if not os.path.isfile(colfile):
+            colfiles = [colfile.replace(".sstcol", "_{0}.sstcol".format(rank)) for rank in range(self.num_ranks)]
+        for path in colfiles:
+            rows += read_columnar_stat_file(path)
+
+        with open(decodedfile, "w") as f:
+            for row in rows:
+                f.write(row + "\n")
+
+        cmp_result = testing_compare_filtered_diff("columnar", decodedfile, reffile, True)
+        self.assertTrue(cmp_result, "Decoded file {0} does not match Reference File {1}".format(decodedfile, reffile))
+
+    def test_StatisticsHistogram(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_histogram.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_StatisticsComponent_histogram.out".format(testsuitedir)
+        outfile = "{0}/test_StatisticsComponent_histogram.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        filter1 = StartsWithFilter("WARNING: No components are")
+        cmp_result = testing_compare_filtered_diff("histogram", outfile, reffile, True, [filter1])
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_StatisticsUniqueCount(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_uniquecount.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_StatisticsComponent_uniquecount.out".format(testsuitedir)
+        outfile = "{0}/test_StatisticsComponent_uniquecount.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        filter1 = StartsWithFilter("WARNING: No components are")
+        cmp_result = testing_compare_filtered_diff("uniquecount", outfile, reffile, True, [filter1])
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
 #####
 
-    def Statistics_test_template(self, testtype):
+    def Statistics_test_template(self, testtype, async_output=False):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
+        otherargs = ""
+        testname = testtype
+        cwd = None
+        if async_output:
+            # The group stat files have fixed names, so run in a separate directory
+            outdir = "{0}/async".format(outdir)
+            os.makedirs(outdir, exist_ok=True)
+            cwd = outdir
+            otherargs = "--async-stat-output"
+            testname = "{0}_async".format(testtype)
 
         sdlfile = "{0}/test_StatisticsComponent_{1}.py".format(testsuitedir, testtype)
         reffile = "{0}/refFiles/test_StatisticsComponent_{1}.out".format(testsuitedir, testtype)
@@ -74,7 +200,7 @@ class testcase_StatisticComponent(SSTTestCase):
         out_group_stat_file_txt = "{0}/test_StatisticsComponent_{1}_group_stats.txt".format(outdir, testtype)
 
         # Perform the test
-        self.run_sst(sdlfile, outfile)
+        self.run_sst(sdlfile, outfile, set_cwd=cwd, other_args=otherargs)
 
         # Combine the stat output files into a single file
         combine_per_rank_files(out_group_stat_file_txt)
@@ -82,12 +208,12 @@ class testcase_StatisticComponent(SSTTestCase):
         combine_per_rank_files(out_group_stat_file_csv)
 
         filter1 = StartsWithFilter("WARNING: No components are")
-        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, [filter1])
+        cmp_result = testing_compare_filtered_diff(testname, outfile, reffile, True, [filter1])
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
 
         filter2 = StartsWithFilter("ComponentName, StatisticName,")
-        cmp_result = testing_compare_filtered_diff(testtype, out_group_stat_file_csv, ref_group_stat_file_csv, True, [filter2])
+        cmp_result = testing_compare_filtered_diff(testname, out_group_stat_file_csv, ref_group_stat_file_csv, True, [filter2])
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(out_group_stat_file_csv, ref_group_stat_file_csv))
 
-        cmp_result = testing_compare_filtered_diff(testtype, out_group_stat_file_txt, ref_group_stat_file_txt, True)
+        cmp_result = testing_compare_filtered_diff(testname, out_group_stat_file_txt, ref_group_stat_file_txt, True)
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(out_group_stat_file_txt, ref_group_stat_file_txt))
@@ -65,12 +65,18 @@ class testcase_Config_input_output(SSTTestCase):
     def test_python_io_parallel(self):
         self.configio_test_template("python_io_parallel", "6 6", "py", True, "MULTI")
 
+    def test_python_io_compact(self):
+        self.configio_test_template("python_io_compact", "6 6", "py", False, "NONE", compact=True)
+
     def test_json_io(self):
         self.configio_test_template("json_io", "6 6", "json", False, "NONE")
 
     def test_json_io_comp(self):
         self.configio_test_template("json_io_comp", "", "json", False, "NONE", True)
 
+    def test_json_io_compact(self):
+        self.configio_test_template("json_io_compact", "6 6", "json", False, "NONE", compact=True)
+
     @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
     def test_json_io_parallel(self):
         self.configio_test_template("json_io_parallel", "6 6", "json", True, "MULTI")
@@ -83,7 +89,7 @@ class testcase_Config_input_output(SSTTestCase):
 
 #####
 
-    def configio_test_template(self, testtype, model_options, output_type, parallel_io, load_mode, use_component_test=False):
+    def configio_test_template(self, testtype, model_options, output_type, parallel_io, load_mode, use_component_test=False, compact=False):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
@@ -98,7 +104,12 @@ class testcase_Config_input_output(SSTTestCase):
             options_ref = "{0}={1} --parallel-output --model-options=\"{2}\"".format(out_flag,output_config,model_options);
         else:
             options_ref = "{0}={1} --output-partition --model-options=\"{2}\"".format(out_flag,output_config,model_options);
-        
+
+        # Latency strings are dropped in a compacted graph, so the
+        # written latencies come from the resolved values
+        if compact:
+            options_ref += " --compact-graph"
+
         if have_mpi:
             options_check = "--parallel-load={0}".format(load_mode)
         else:
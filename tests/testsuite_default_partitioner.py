@@ -35,6 +35,31 @@ def initializeTestModule_SingleInstance(class_inst):
 
 ################################################################################
 
+def read_component_costs(path):
+    """Read the component handler times from a partition cost file"""
+    costs = {}
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) == 3 and fields[0] == "component":
+                costs[fields[1]] = int(fields[2])
+    return costs
+
+def read_partition(path):
+    """Read the rank.thread of each component from a partition file"""
+    parts = {}
+    part = None
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) >= 2 and fields[0] == "Rank:":
+                part = fields[1]
+            elif len(fields) == 2 and fields[1].startswith("(ID="):
+                parts[fields[0]] = part
+    return parts
+
+################################################################################
+
 class testcase_Partitioners(SSTTestCase):
 
     def initializeClass(self, testName):
@@ -63,9 +88,53 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_multilevel(self):
+        self.partitioner_test_template("multilevel", "6 6", "sst.multilevel")
+
+    def test_multilevel_costs(self):
+        self.partitioner_test_template("multilevel_costs", "6 6", "sst.multilevel", use_costs=True)
+
+    def test_clock_costs(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # The clocker components have no links, so all of their cost
+        # has to come from their clock handlers
+        sdlfile = "{0}/test_partitioner_clocks.py".format(testsuitedir)
+        outfile = "{0}/test_partitioner_clock_costs.out".format(outdir)
+        costfile = "{0}/test_partitioner_clock_costs.costs".format(outdir)
+
+        options = "--output-partition-costs={0}".format(costfile)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=1)
+
+        costs = read_component_costs(costfile)
+        for i in range(8):
+            name = "clocker{0}".format(i)
+            self.assertTrue(costs.get(name, 0) > 0, "No clock handler time for {0} in {1}".format(name, costfile))
+
+    def test_multilevel_nocut(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # The components are linked directly rather than through
+        # subcomponents, and some of the links are no-cut
+        sdlfile = "{0}/test_partitioner_nocut.py".format(testsuitedir)
+        outfile = "{0}/test_partitioner_multilevel_nocut.out".format(outdir)
+        partfile = "{0}/test_partitioner_multilevel_nocut.part".format(outdir)
+
+        options = "--partitioner=sst.multilevel --output-partition={0}".format(partfile)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=2)
+
+        # The only good split is one cluster per thread
+        parts = read_partition(partfile)
+        for c in [ "A", "B" ]:
+            cluster = set(parts.get("{0}{1}".format(c, i)) for i in range(6))
+            self.assertEqual(len(cluster), 1, "Cluster {0} was split across {1} in {2}".format(c, sorted(cluster), partfile))
+        self.assertNotEqual(parts["A0"], parts["B0"], "Both clusters were put in {0} in {1}".format(parts["A0"], partfile))
+
 #####
 
-    def partitioner_test_template(self, testtype, model_options, partitioner):
+    def partitioner_test_template(self, testtype, model_options, partitioner, use_costs=False):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
@@ -75,10 +144,26 @@ class testcase_Partitioners(SSTTestCase):
         sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
         outfile_ref = "{0}/test_partitioner_ref_{1}.out".format(outdir, testtype)
         outfile_check = "{0}/test_partitioner_check_{1}.out".format(outdir, testtype)
+        costfile = "{0}/test_partitioner_{1}.costs".format(outdir, testtype)
+
+        # Measure costs in the reference run and partition the check
+        # run with them
+        ref_options = options
+        check_options = options
+        if use_costs:
+            ref_options += " --output-partition-costs={0}".format(costfile)
+            check_options += " --partition-costs={0}".format(costfile)
 
         # Do a serial reference run
-        self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
-        self.run_sst(sdlfile, outfile_check, other_args=options)
+        self.run_sst(sdlfile, outfile_ref, other_args=ref_options, num_ranks=1, num_threads=1)
+        if use_costs:
+            self.assertTrue(os.path.isfile(costfile), "Partition cost file {0} was not written".format(costfile))
+            # Every router gets messages, so every one should have a cost
+            costs = read_component_costs(costfile)
+            for i in range(36):
+                name = "component{0}".format(i)
+                self.assertTrue(costs.get(name, 0) > 0, "No handler time for {0} in {1}".format(name, costfile))
+        self.run_sst(sdlfile, outfile_check, other_args=check_options)
 
         # Perform the test
         cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)